@@ -21,14 +21,40 @@
 *   // inspect the internal components
 *   std::cout << "E = " << E << std::endl;  // E = {0, 1, 1, 0, 0, 0, 1, 0, 0}
 *
+*   // bit-packed booleans (one bit per flag, word level operations)
+*   ArrayOfBits<std::uint64_t> F(0b10110000);
+*   F.set(1);
+*   std::cout << F.count() << ", " << F.find_first() << std::endl;  // 4, 1
+*
 * Dan Israel Malta
 **/
 #pragma once
 #include<type_traits>
 #include<inttypes.h>
+#include<assert.h>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
 #include<iostream>
 #include <string>
 
+#if defined(__AVX2__)
+#define ARRAY_OF_BYTES_AVX2
+#include<immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ARRAY_OF_BYTES_SSE2
+#include<emmintrin.h>
+#endif
+
+#if defined(__SSSE3__) || defined(_MSC_VER)
+#define ARRAY_OF_BYTES_SSSE3
+#include<immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include<stdlib.h>
+#endif
+
 // type traits
 namespace {
     // type trait to test if an object is iterate-able
@@ -43,6 +69,63 @@ namespace {
     // type trait to test if an object is a boolean type
     template<typename> struct is_bool       : public std::false_type {};
     template<>         struct is_bool<bool> : public std::true_type  {};
+
+    // amount of set bits in a word
+    inline constexpr std::size_t popcount(const std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+        std::uint64_t v{ x - ((x >> 1) & 0x5555555555555555ull) };
+        v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<std::size_t>((v * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    // true if platform is little endian
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    inline constexpr bool is_little_endian{ false };
+#else
+    inline constexpr bool is_little_endian{ true };
+#endif
+
+    // reverse the bytes of an integral value
+    template<typename T> inline T byteswap(const T x) noexcept {
+        static_assert(std::is_integral<T>::value, "byteswap: 'T' must be an integral type.");
+        using U = typename std::make_unsigned<T>::type;
+        const U u{ static_cast<U>(x) };
+
+        if constexpr (sizeof(T) == 1) {
+            return x;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        else if constexpr (sizeof(T) == 2) return static_cast<T>(__builtin_bswap16(u));
+        else if constexpr (sizeof(T) == 4) return static_cast<T>(__builtin_bswap32(u));
+        else if constexpr (sizeof(T) == 8) return static_cast<T>(__builtin_bswap64(u));
+#elif defined(_MSC_VER)
+        else if constexpr (sizeof(T) == 2) return static_cast<T>(_byteswap_ushort(u));
+        else if constexpr (sizeof(T) == 4) return static_cast<T>(_byteswap_ulong(u));
+        else if constexpr (sizeof(T) == 8) return static_cast<T>(_byteswap_uint64(u));
+#endif
+        else {
+            U r{};
+            for (std::size_t i{}; i < sizeof(T); ++i) {
+                r = static_cast<U>((r << 8) | ((u >> (8 * i)) & 0xFF));
+            }
+            return static_cast<T>(r);
+        }
+    }
+
+    // index of lowest set bit in a word (x must not be zero)
+    inline constexpr std::size_t countr_zero(const std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(x));
+#else
+        std::size_t i{};
+        while (((x >> i) & 1u) == 0) ++i;
+        return i;
+#endif
+    }
 }
 
 /**
@@ -119,6 +202,14 @@ template<class Type, class Byte = bool> union ArrayOfBytes {
     // cast operator
     operator Type() const { return value; }
 
+    // --- endianness ---
+    // (conversions operate on the bytes of 'Type', regardless of 'Byte')
+    ArrayOfBytes byteswap()           const { return ArrayOfBytes(::byteswap(value)); }
+    ArrayOfBytes to_big_endian()      const { return is_little_endian ? byteswap() : *this; }
+    ArrayOfBytes from_big_endian()    const { return to_big_endian(); }
+    ArrayOfBytes to_little_endian()   const { return is_little_endian ? *this : byteswap(); }
+    ArrayOfBytes from_little_endian() const { return to_little_endian(); }
+
     // set/get components at specific index using the '[]' operator
     constexpr Byte  operator[](const std::size_t i) const { assert(i < ByteCount); return values[i]; }
     constexpr Byte& operator[](const std::size_t i)       { assert(i < ByteCount); return values[i]; }
@@ -142,50 +233,33 @@ template<class Type, class Byte = bool> union ArrayOfBytes {
     }
 
     // --- logical operations with boolean components ---
+    // (boolean components are either 0 or 1, so a component wise operation is a single operation on 'value')
 #define M_LOGICAL_OPERATOR(OP, AOP)                                                                    \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (const ArrayOfBytes& lhs, const Type rhs) {              \
-        ArrayOfBytes<Type, Byte> temp(rhs);                                                            \
-        for (std::size_t i{}; i < temp.ByteCount; ++i) {                                               \
-            temp[i] AOP lhs[i];                                                                        \
-        }                                                                                              \
-        return temp;                                                                                   \
+        return ArrayOfBytes<Type, Byte>(static_cast<Type>(lhs.value OP rhs));                          \
     }                                                                                                  \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (const Type rhs, const ArrayOfBytes& lhs) {              \
-        ArrayOfBytes<Type, Byte> temp(rhs);                                                            \
-        for (std::size_t i{}; i < temp.ByteCount; ++i) {                                               \
-            temp[i] AOP lhs[i];                                                                        \
-        }                                                                                              \
-        return temp;                                                                                   \
+        return ArrayOfBytes<Type, Byte>(static_cast<Type>(rhs OP lhs.value));                          \
     }                                                                                                  \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (const ArrayOfBytes& lhs, const ArrayOfBytes& rhs) {     \
-        ArrayOfBytes<Type, Byte> temp(rhs);                                                            \
-        for (std::size_t i{}; i < temp.ByteCount; ++i) {                                               \
-            temp[i] AOP lhs[i];                                                                        \
-        }                                                                                              \
-        return temp;                                                                                   \
+        return ArrayOfBytes<Type, Byte>(static_cast<Type>(lhs.value OP rhs.value));                    \
     }                                                                                                  \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (ArrayOfBytes&& lhs, const ArrayOfBytes& rhs) {          \
-        for (std::size_t i{}; i < lhs.ByteCount; ++i) {                                                \
-            lhs[i] AOP rhs[i];                                                                         \
-        }                                                                                              \
+        lhs.value AOP rhs.value;                                                                       \
         return lhs;                                                                                    \
     }                                                                                                  \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (const ArrayOfBytes& lhs, ArrayOfBytes&& rhs) {          \
-        for (std::size_t i{}; i < lhs.ByteCount; ++i) {                                                \
-            rhs[i] AOP lhs[i];                                                                         \
-        }                                                                                              \
+        rhs.value AOP lhs.value;                                                                       \
         return rhs;                                                                                    \
     }                                                                                                  \
     template<class b = Byte, typename std::enable_if<is_bool<b>::value>::type* = nullptr>              \
     friend constexpr ArrayOfBytes operator OP (ArrayOfBytes&& lhs, ArrayOfBytes&& rhs) {               \
-        for (std::size_t i{}; i < lhs.ByteCount; ++i) {                                                \
-            lhs[i] AOP rhs[i];                                                                         \
-        }                                                                                              \
+        lhs.value AOP rhs.value;                                                                       \
         return lhs;                                                                                    \
     }
 
@@ -195,3 +269,267 @@ template<class Type, class Byte = bool> union ArrayOfBytes {
 
 #undef M_LOGICAL_OPERATOR
 };
+
+/**
+* \brief helper object to deal with integral types as a bit-packed array of booleans
+*        (same as 'ArrayOfBytes<Type, bool>', but each flag occupies a single bit and all operations are word level)
+*
+* @param {Type, in} integral type to be handled as array of bits
+**/
+template<class Type> struct ArrayOfBits {
+    static_assert(std::is_integral<Type>::value, "ArrayOfBits<Type>: 'Type' must be an integral type.");
+
+    // 'constants'
+    enum : std::size_t { BitCount = sizeof(Type) * 8 };  // how many bits there are in 'Type'
+
+    // properties
+    Type value;
+
+    // construct by 'Type'
+    constexpr ArrayOfBits() : value{} {}
+    template<class U> explicit constexpr ArrayOfBits(const U& v, typename std::enable_if<is_IntegralConvertible<U, Type>::value>::type* = nullptr) : value(static_cast<Type>(v)) {}
+
+    // construct from collection of booleans (should have no more then 'BitCount' elements)
+    template<typename Collection, typename std::enable_if<is_iterate_able<Collection>::value>::type* = nullptr>
+    explicit constexpr ArrayOfBits(const Collection& xi_collection) : value{} {
+        std::size_t i{};
+        for (const auto& c : xi_collection) {
+            if (static_cast<bool>(c)) set(i);
+            ++i;
+            if (i == BitCount) break;
+        }
+    }
+
+    // cast operator
+    operator Type() const { return value; }
+
+    // set/get bit at specific index
+    constexpr bool operator[](const std::size_t i) const { return test(i); }
+    constexpr bool test(const std::size_t i) const { assert(i < BitCount); return (word() >> i) & 1u; }
+    constexpr ArrayOfBits& set(const std::size_t i, const bool v = true) {
+        assert(i < BitCount);
+        value = static_cast<Type>(v ? (word() | mask(i)) : (word() & ~mask(i)));
+        return *this;
+    }
+    constexpr ArrayOfBits& reset(const std::size_t i) { return set(i, false); }
+    constexpr ArrayOfBits& flip(const std::size_t i)  { assert(i < BitCount); value = static_cast<Type>(word() ^ mask(i)); return *this; }
+
+    // amount of set bits
+    constexpr std::size_t count() const noexcept { return popcount(word()); }
+    constexpr bool any()  const noexcept { return word() != 0; }
+    constexpr bool none() const noexcept { return word() == 0; }
+    constexpr bool all()  const noexcept { return word() == static_cast<Word>(~Word{}); }
+
+    // index of first set bit ('BitCount' if no bit is set)
+    constexpr std::size_t find_first() const noexcept { return any() ? countr_zero(word()) : BitCount; }
+
+    // index of first set bit after a given index ('BitCount' if there is none)
+    constexpr std::size_t find_next(const std::size_t i) const noexcept {
+        if (i + 1 >= BitCount) return BitCount;
+        const Word rest{ static_cast<Word>(word() >> (i + 1)) };
+        return (rest != 0) ? i + 1 + countr_zero(rest) : BitCount;
+    }
+
+    // --- relational (equality) operators ---
+    constexpr bool operator==(const ArrayOfBits& other) const { return value == other.value; }
+    constexpr bool operator!=(const ArrayOfBits& other) const { return value != other.value; }
+
+    // --- logical operations ---
+    constexpr ArrayOfBits& operator&=(const ArrayOfBits& other) { value = static_cast<Type>(value & other.value); return *this; }
+    constexpr ArrayOfBits& operator|=(const ArrayOfBits& other) { value = static_cast<Type>(value | other.value); return *this; }
+    constexpr ArrayOfBits& operator^=(const ArrayOfBits& other) { value = static_cast<Type>(value ^ other.value); return *this; }
+    friend constexpr ArrayOfBits operator&(ArrayOfBits lhs, const ArrayOfBits& rhs) { return lhs &= rhs; }
+    friend constexpr ArrayOfBits operator|(ArrayOfBits lhs, const ArrayOfBits& rhs) { return lhs |= rhs; }
+    friend constexpr ArrayOfBits operator^(ArrayOfBits lhs, const ArrayOfBits& rhs) { return lhs ^= rhs; }
+    constexpr ArrayOfBits operator~() const { return ArrayOfBits(static_cast<Type>(~word())); }
+
+    // print components
+    friend std::ostream& operator<<(std::ostream& xio_stream, const ArrayOfBits& arr) {
+        xio_stream << "{";
+        for (std::size_t i{}; i < BitCount - 1; ++i) {
+            xio_stream << arr[i] << ", ";
+        }
+        xio_stream << arr[BitCount - 1] << "}";
+
+        return xio_stream;
+    }
+
+    // internal helpers
+    private:
+        using Word = typename std::make_unsigned<Type>::type;
+        constexpr Word word() const noexcept { return static_cast<Word>(value); }
+        static constexpr Word mask(const std::size_t i) noexcept { return static_cast<Word>(Word{ 1 } << i); }
+};
+
+/**
+* \brief bulk (span level) logical operations over contiguous arrays of 'ArrayOfBytes<Type, bool>' or 'ArrayOfBits<Type>'.
+*        arrays are processed 32 bytes (AVX2) or 16 bytes (SSE2) at a time.
+*
+*   std::vector<ArrayOfBits<std::uint64_t>> a(1024), b(1024), c(1024);
+*   BulkBits::bitwise_and(a.data(), b.data(), c.data(), a.size());   // c[i] = a[i] & b[i]
+*   const std::size_t n{ BulkBits::count(c.data(), c.size()) };     // amount of set bits in c
+**/
+namespace BulkBits {
+
+    namespace detail {
+        template<typename T> struct is_bit_array : std::false_type {};
+        template<class Type> struct is_bit_array<ArrayOfBytes<Type, bool>> : std::true_type {};
+        template<class Type> struct is_bit_array<ArrayOfBits<Type>> : std::true_type {};
+
+        enum class Operation { And, Or, Xor };
+
+        template<Operation OP, typename T> inline T apply(const T a, const T b) noexcept {
+            if constexpr (OP == Operation::And)     return static_cast<T>(a & b);
+            else if constexpr (OP == Operation::Or) return static_cast<T>(a | b);
+            else                                    return static_cast<T>(a ^ b);
+        }
+
+        template<Operation OP, class A> void apply(const A* xi_lhs, const A* xi_rhs, A* xo_out, const std::size_t xi_count) noexcept {
+            static_assert(is_bit_array<A>::value, "BulkBits: operands must be either 'ArrayOfBytes<Type, bool>' or 'ArrayOfBits<Type>'.");
+            static_assert(sizeof(A) == sizeof(A::value), "BulkBits: operands must not be padded.");
+
+            const unsigned char* lhs{ reinterpret_cast<const unsigned char*>(xi_lhs) };
+            const unsigned char* rhs{ reinterpret_cast<const unsigned char*>(xi_rhs) };
+            unsigned char* out{ reinterpret_cast<unsigned char*>(xo_out) };
+            const std::size_t bytes{ xi_count * sizeof(A) };
+            std::size_t i{};
+
+#if defined(ARRAY_OF_BYTES_AVX2)
+            for (; i + 32 <= bytes; i += 32) {
+                const __m256i a{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)) },
+                              b{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)) };
+                __m256i c;
+                if constexpr (OP == Operation::And)     c = _mm256_and_si256(a, b);
+                else if constexpr (OP == Operation::Or) c = _mm256_or_si256(a, b);
+                else                                    c = _mm256_xor_si256(a, b);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), c);
+            }
+#elif defined(ARRAY_OF_BYTES_SSE2)
+            for (; i + 16 <= bytes; i += 16) {
+                const __m128i a{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)) },
+                              b{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)) };
+                __m128i c;
+                if constexpr (OP == Operation::And)     c = _mm_and_si128(a, b);
+                else if constexpr (OP == Operation::Or) c = _mm_or_si128(a, b);
+                else                                    c = _mm_xor_si128(a, b);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), c);
+            }
+#endif
+            for (; i < bytes; ++i) {
+                out[i] = apply<OP>(lhs[i], rhs[i]);
+            }
+        }
+    }
+
+    /**
+    * \brief element wise logical operation between two arrays (output may alias any of the inputs)
+    *
+    * @param {A*,     in}  left hand side array
+    * @param {A*,     in}  right hand side array
+    * @param {A*,     out} output array
+    * @param {size_t, in}  amount of elements in each array
+    **/
+    template<class A> void bitwise_and(const A* xi_lhs, const A* xi_rhs, A* xo_out, const std::size_t xi_count) noexcept { detail::apply<detail::Operation::And>(xi_lhs, xi_rhs, xo_out, xi_count); }
+    template<class A> void bitwise_or (const A* xi_lhs, const A* xi_rhs, A* xo_out, const std::size_t xi_count) noexcept { detail::apply<detail::Operation::Or>(xi_lhs, xi_rhs, xo_out, xi_count);  }
+    template<class A> void bitwise_xor(const A* xi_lhs, const A* xi_rhs, A* xo_out, const std::size_t xi_count) noexcept { detail::apply<detail::Operation::Xor>(xi_lhs, xi_rhs, xo_out, xi_count); }
+
+    /**
+    * \brief amount of set bits in an array of 'ArrayOfBits<Type>'
+    *
+    * @param {ArrayOfBits*, in}  array
+    * @param {size_t,       in}  amount of elements in array
+    * @param {size_t,       out} amount of set bits
+    **/
+    template<class Type> std::size_t count(const ArrayOfBits<Type>* xi_data, const std::size_t xi_count) noexcept {
+        std::size_t sum{};
+        for (std::size_t i{}; i < xi_count; ++i) sum += xi_data[i].count();
+        return sum;
+    }
+
+    /**
+    * \brief index of first set bit in an array of 'ArrayOfBits<Type>'
+    *
+    * @param {ArrayOfBits*, in}  array
+    * @param {size_t,       in}  amount of elements in array
+    * @param {size_t,       out} bit index (amount of bits in array if no bit is set)
+    **/
+    template<class Type> std::size_t find_first(const ArrayOfBits<Type>* xi_data, const std::size_t xi_count) noexcept {
+        for (std::size_t i{}; i < xi_count; ++i) {
+            if (xi_data[i].any()) return i * ArrayOfBits<Type>::BitCount + xi_data[i].find_first();
+        }
+        return xi_count * ArrayOfBits<Type>::BitCount;
+    }
+}
+
+/**
+* \brief bulk (span level) endian conversion over contiguous arrays of 16/32/64 bit integers (or 'ArrayOfBytes' of such types).
+*        arrays are processed 32 bytes (AVX2) or 16 bytes (SSSE3) at a time using a byte shuffle.
+*
+*   std::vector<std::uint32_t> fields(1 << 20);
+*   BulkEndian::from_big_endian(fields.data(), fields.data(), fields.size());   // in place network -> host order
+**/
+namespace BulkEndian {
+
+    namespace detail {
+        template<typename T> struct is_swappable : std::integral_constant<bool, std::is_integral<T>::value> {};
+        template<class Type, class Byte> struct is_swappable<ArrayOfBytes<Type, Byte>> : std::true_type {};
+
+        // integral type of a given size
+        template<std::size_t N> struct word;
+        template<> struct word<2> { using type = std::uint16_t; };
+        template<> struct word<4> { using type = std::uint32_t; };
+        template<> struct word<8> { using type = std::uint64_t; };
+    }
+
+    /**
+    * \brief reverse the bytes of each element in an array (output may alias input)
+    *
+    * @param {T*,     in}  input array
+    * @param {T*,     out} output array
+    * @param {size_t, in}  amount of elements in array
+    **/
+    template<class T> void byteswap(const T* xi_in, T* xo_out, const std::size_t xi_count) noexcept {
+        static_assert(detail::is_swappable<T>::value && ((sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8)),
+                      "BulkEndian: elements must be 16/32/64 bit integers (or 'ArrayOfBytes' of such).");
+        using W = typename detail::word<sizeof(T)>::type;
+
+        const unsigned char* in{ reinterpret_cast<const unsigned char*>(xi_in) };
+        unsigned char* out{ reinterpret_cast<unsigned char*>(xo_out) };
+        const std::size_t bytes{ xi_count * sizeof(T) };
+        std::size_t i{};
+
+#ifdef ARRAY_OF_BYTES_SSSE3
+        // shuffle mask reversing each 'sizeof(T)' bytes lane
+        alignas(16) char order[16];
+        for (std::size_t j{}; j < 16; ++j) {
+            order[j] = static_cast<char>((j / sizeof(T)) * sizeof(T) + (sizeof(T) - 1 - j % sizeof(T)));
+        }
+        const __m128i mask{ _mm_load_si128(reinterpret_cast<const __m128i*>(order)) };
+
+#ifdef ARRAY_OF_BYTES_AVX2
+        const __m256i mask2{ _mm256_broadcastsi128_si256(mask) };
+        for (; i + 32 <= bytes; i += 32) {
+            const __m256i v{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)) };
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(v, mask2));
+        }
+#endif
+        for (; i + 16 <= bytes; i += 16) {
+            const __m128i v{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)) };
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(v, mask));
+        }
+#endif
+        for (; i < bytes; i += sizeof(T)) {
+            W w;
+            std::memcpy(&w, in + i, sizeof(W));
+            w = ::byteswap(w);
+            std::memcpy(out + i, &w, sizeof(W));
+        }
+    }
+
+    // convert an array from host order to big endian (network) order, and vice versa (output may alias input)
+    template<class T> void to_big_endian(const T* xi_in, T* xo_out, const std::size_t xi_count) noexcept {
+        if constexpr (is_little_endian) byteswap(xi_in, xo_out, xi_count);
+        else if (xi_in != xo_out) std::memmove(static_cast<void*>(xo_out), static_cast<const void*>(xi_in), xi_count * sizeof(T));
+    }
+    template<class T> void from_big_endian(const T* xi_in, T* xo_out, const std::size_t xi_count) noexcept { to_big_endian(xi_in, xo_out, xi_count); }
+}
@@ -0,0 +1,226 @@
+/**
+* A succinct bit vector with constant time rank and (near) constant time select.
+*
+* bits are stored as 64bit words ('ArrayOfBits<std::uint64_t>'), and once all bits are set, 'build' creates:
+* > a two level rank directory - absolute rank every 4096 bits (64bit) and relative rank every 512 bits (16bit),
+*   so 'rank1' is two directory reads followed by at most eight word popcounts.
+* > a sampled select index - the super block of every 8192'th set bit, so 'select1' binary searches only the
+*   super blocks between two samples (a handful in dense vectors, logarithmic in sparse ones).
+* directories overhead is ~4.7% (plus <0.8% for the select samples).
+* block popcounts during 'build' are calculated 128 bits at a time (requires SSSE3, otherwise a word by word popcount is performed).
+*
+* example usage:
+*
+*   BitVector bits(1'000'000);
+*   for (std::size_t i{}; i < bits.size(); i += 3) bits.set(i);
+*   bits.build();
+*
+*   std::cout << bits.rank1(10) << "\n";       // 4 (0, 3, 6, 9)
+*   std::cout << bits.select1(4) << "\n";      // 12
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include"ArrayOfBytes.h"
+#include<algorithm>
+#include<assert.h>
+#include<cstdint>
+#include<vector>
+
+#if defined(__SSSE3__) || defined(_MSC_VER)
+#define BIT_VECTOR_SIMD_BUILD
+#include<immintrin.h>
+#endif
+
+#if defined(__BMI2__)
+#define BIT_VECTOR_PDEP
+#include<immintrin.h>
+#endif
+
+/**
+* \brief succinct bit vector with rank/select support
+**/
+class BitVector {
+    // aliases
+    using Word = ArrayOfBits<std::uint64_t>;
+
+    // 'constants'
+    enum : std::size_t { WordBits         = 64,
+                         BlockWords       = 8,                          // 512 bits per block
+                         BlockBits        = WordBits * BlockWords,
+                         SuperBlockBlocks = 8,                          // 4096 bits per super block
+                         SuperBlockBits   = BlockBits * SuperBlockBlocks,
+                         SelectSample     = 8192 };                     // select sample every 8192 set bits
+
+    // properties
+    private:
+        std::vector<Word>          m_words;         // padded to a whole number of blocks
+        std::vector<std::uint64_t> m_superBlocks;   // amount of set bits before each super block (and a final total)
+        std::vector<std::uint16_t> m_blocks;        // amount of set bits before each block, relative to its super block
+        std::vector<std::uint64_t> m_samples;       // super block holding every 'SelectSample' set bit
+        std::size_t                m_size{};
+        bool                       m_built{ false };
+
+    // constructor
+    public:
+        explicit BitVector(const std::size_t xi_size = 0) : m_words(((xi_size + BlockBits - 1) / BlockBits) * BlockWords), m_size(xi_size) {}
+
+    // API
+    public:
+
+        // amount of bits
+        std::size_t size() const noexcept { return m_size; }
+
+        // underlying words
+        const std::vector<Word>& words() const noexcept { return m_words; }
+
+        // set/get bit at specific index (modification invalidates the rank/select directories)
+        bool operator[](const std::size_t i) const noexcept { return test(i); }
+        bool test(const std::size_t i) const noexcept { assert(i < m_size); return m_words[i / WordBits].test(i % WordBits); }
+        void set(const std::size_t i, const bool v = true) noexcept {
+            assert(i < m_size);
+            m_words[i / WordBits].set(i % WordBits, v);
+            m_built = false;
+        }
+        void reset(const std::size_t i) noexcept { set(i, false); }
+
+        /**
+        * \brief build rank/select directories (should be called after bits are set and before 'rank'/'select' are used)
+        **/
+        void build() {
+            const std::size_t blocks{ m_words.size() / BlockWords },
+                              superBlocks{ (blocks + SuperBlockBlocks - 1) / SuperBlockBlocks };
+
+            m_blocks.assign(blocks, 0);
+            m_superBlocks.assign(superBlocks + 1, 0);
+            m_samples.clear();
+
+            std::uint64_t total{};
+            for (std::size_t s{}; s < superBlocks; ++s) {
+                m_superBlocks[s] = total;
+
+                std::uint64_t relative{};
+                for (std::size_t b{ s * SuperBlockBlocks }; (b < blocks) && (b < (s + 1) * SuperBlockBlocks); ++b) {
+                    m_blocks[b] = static_cast<std::uint16_t>(relative);
+
+                    const std::uint64_t ones{ BlockPopcount(&m_words[b * BlockWords]) };
+
+                    // sample super block of every 'SelectSample' set bit
+                    const std::uint64_t before{ total + relative };
+                    for (std::uint64_t k{ ((before + SelectSample - 1) / SelectSample) * SelectSample }; k < before + ones; k += SelectSample) {
+                        m_samples.push_back(s);
+                    }
+
+                    relative += ones;
+                }
+
+                total += relative;
+            }
+            m_superBlocks[superBlocks] = total;
+
+            m_built = true;
+        }
+
+        // amount of set bits (requires 'build')
+        std::size_t count() const noexcept { assert(m_built); return static_cast<std::size_t>(m_superBlocks.back()); }
+
+        /**
+        * \brief amount of set bits in [0, i) (requires 'build')
+        *
+        * @param {size_t, in}  index (not larger then 'size()')
+        * @param {size_t, out} amount of set bits before index
+        **/
+        std::size_t rank1(const std::size_t i) const noexcept {
+            assert(m_built && (i <= m_size));
+
+            const std::size_t word{ i / WordBits },
+                              block{ i / BlockBits };
+            if (block == m_blocks.size()) return count();
+
+            std::uint64_t rank{ m_superBlocks[i / SuperBlockBits] + m_blocks[block] };
+            for (std::size_t w{ block * BlockWords }; w < word; ++w) rank += m_words[w].count();
+
+            const std::size_t bit{ i % WordBits };
+            if (bit > 0) rank += popcount(m_words[word].value << (WordBits - bit));
+
+            return static_cast<std::size_t>(rank);
+        }
+
+        // amount of cleared bits in [0, i) (requires 'build')
+        std::size_t rank0(const std::size_t i) const noexcept { return i - rank1(i); }
+
+        /**
+        * \brief position of the k'th (0 based) set bit (requires 'build')
+        *
+        * @param {size_t, in}  k (smaller then 'count()')
+        * @param {size_t, out} bit index
+        **/
+        std::size_t select1(std::size_t k) const noexcept {
+            assert(m_built && (k < count()));
+
+            // super block (binary search between sample and next sample, so sparse vectors are not scanned)
+            const std::size_t sample{ k / SelectSample },
+                              lower{ static_cast<std::size_t>(m_samples[sample]) },
+                              upper{ (sample + 1 < m_samples.size()) ? static_cast<std::size_t>(m_samples[sample + 1]) : m_superBlocks.size() - 2 };
+            const std::size_t s{ static_cast<std::size_t>(std::upper_bound(m_superBlocks.begin() + lower + 1, m_superBlocks.begin() + upper + 2, k) - m_superBlocks.begin()) - 1 };
+            k -= static_cast<std::size_t>(m_superBlocks[s]);
+
+            // block
+            std::size_t b{ s * SuperBlockBlocks };
+            const std::size_t last{ std::min(m_blocks.size(), (s + 1) * SuperBlockBlocks) };
+            while ((b + 1 < last) && (m_blocks[b + 1] <= k)) ++b;
+            k -= m_blocks[b];
+
+            // word
+            std::size_t w{ b * BlockWords };
+            for (std::size_t ones{ m_words[w].count() }; ones <= k; ones = m_words[w].count()) {
+                k -= ones;
+                ++w;
+            }
+
+            return w * WordBits + SelectInWord(m_words[w].value, k);
+        }
+
+    // internal helpers
+    private:
+
+        // amount of set bits in a block
+        static std::uint64_t BlockPopcount(const Word* xi_block) noexcept {
+#ifdef BIT_VECTOR_SIMD_BUILD
+            // nibble lookup popcount, summed per 64bit lane
+            const __m128i table{ _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4) },
+                          nibble{ _mm_set1_epi8(0x0F) };
+            __m128i sum{ _mm_setzero_si128() };
+            for (std::size_t i{}; i < BlockWords; i += 2) {
+                const __m128i v{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(xi_block + i)) },
+                              lo{ _mm_shuffle_epi8(table, _mm_and_si128(v, nibble)) },
+                              hi{ _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble)) };
+                sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_add_epi8(lo, hi), _mm_setzero_si128()));
+            }
+            alignas(16) std::uint64_t lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), sum);
+            return lanes[0] + lanes[1];
+#else
+            std::uint64_t sum{};
+            for (std::size_t i{}; i < BlockWords; ++i) sum += xi_block[i].count();
+            return sum;
+#endif
+        }
+
+        // position of the k'th (0 based) set bit in a word (word must have more then k set bits)
+        static std::size_t SelectInWord(std::uint64_t xi_word, std::size_t k) noexcept {
+#ifdef BIT_VECTOR_PDEP
+            return countr_zero(_pdep_u64(std::uint64_t{ 1 } << k, xi_word));
+#else
+            // skip whole bytes, then clear lower set bits
+            std::size_t shift{};
+            for (std::size_t ones{ popcount(xi_word & 0xFF) }; ones <= k; ones = popcount(xi_word & 0xFF)) {
+                k -= ones;
+                xi_word >>= 8;
+                shift += 8;
+            }
+            for (; k > 0; --k) xi_word &= xi_word - 1;
+            return shift + countr_zero(xi_word);
+#endif
+        }
+};
@@ -5,6 +5,14 @@
 **/
 #pragma once
 #include <type_traits>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 
 namespace CompileTimeDictionary {
 
@@ -14,7 +22,7 @@ namespace CompileTimeDictionary {
 	*        usage is: using dict = Dictionary<Entry<x1,y1>, Entry<x2,y2>, ...>;
 	**/
 	template<int K, int V> struct Entry { enum { Key = K, Value = V }; };
-	template<typename ...Entrys> struct Dictionary {};
+	template<typename ...Entrys> struct Dictionary;
 
 	/**
 	* \brief a helper struct which holds its own type
@@ -31,42 +39,58 @@ namespace CompileTimeDictionary {
 	template<typename...B> struct size<Dictionary<B...>> { enum { Value = sizeof...(B) }; };
 	template<typename...B> inline constexpr int size_v = size<B...>::Value;
 
+	//
+	// implementation of compile time queries
+	// (queries are evaluated with a constant instantiation depth, regardless of dictionary size)
+	//
+	namespace detail {
+
+		// index of the first element in a pack equal to a given value ('sizeof...(Xs)' if it does not exist)
+		template<int I, int ...Xs> constexpr std::size_t first_index() noexcept {
+			constexpr bool match[]{ (I == Xs)..., false };
+			std::size_t i{};
+			while ((i < sizeof...(Xs)) && !match[i]) ++i;
+			return i;
+		}
+
+		// pack element at a given index (selected by overload resolution against indexed bases)
+		template<std::size_t I, typename T> struct Indexed { using type = T; };
+		template<typename S, typename ...Ts> struct Indexer;
+		template<std::size_t ...Is, typename ...Ts> struct Indexer<std::index_sequence<Is...>, Ts...> : Indexed<Is, Ts>... {};
+		template<std::size_t I, typename T> Indexed<I, T> select(const Indexed<I, T>&);
+		template<std::size_t I, typename ...Ts> using nth = typename decltype(select<I>(Indexer<std::index_sequence_for<Ts...>, Ts...>{}))::type;
+	}
+
 	/**
 	* \brief given a key and a dictionary, extract the appropriate value
+	*        (if several entries share the key - the first one)
 	*
 	* @param {in}  key
 	* @param {in}  dictionary
 	* @param {out} value
 	**/
 	template<int I, typename M> struct GetValueFromKey;
-	template<int I, typename A> struct GetValueFromKey<I, Dictionary<A>> {
-		using meta = typename std::conditional<I == A::Key, Identity<A>, void>::type;
-		using type = typename meta::type;
-		enum { value = type::Value };
-	};
-	template<int I, typename A, typename ...B> struct GetValueFromKey<I, Dictionary<A, B...> > {
-		using meta = typename std::conditional<I == A::Key, Identity<A>, GetValueFromKey<I, Dictionary<B...>>>::type;
-		using type = typename meta::type;
+	template<int I, typename ...B> struct GetValueFromKey<I, Dictionary<B...>> {
+		static constexpr std::size_t index{ detail::first_index<I, B::Key...>() };
+		static_assert(index < sizeof...(B), "CompileTimeDictionary: key does not exist in dictionary.");
+		using type = detail::nth<index, B...>;
 		enum { value = type::Value };
 	};
 	template<int I, typename A> inline constexpr int GetValueFromKey_v = GetValueFromKey<I, A>::value;
 
 	/**
 	* \brief given a value and a dictionary, extract the appropriate key
+	*        (if several entries share the value - the first one)
 	*
 	* @param {in}  value
 	* @param {in}  dictionary
 	* @param {out} key
 	**/
 	template<int I, typename M> struct GetKeyFromValue;
-	template<int I, typename A> struct GetKeyFromValue<I, Dictionary<A>> {
-		using meta = typename std::conditional<I == A::Value, Identity<A>, void>::type;
-		using type = typename meta::type;
-		enum { value = type::Key };
-	};
-	template<int I, typename A, typename ...B> struct GetKeyFromValue<I, Dictionary<A, B...> > {
-		using meta = typename std::conditional<I == A::Value, Identity<A>, GetKeyFromValue<I, Dictionary<B...>>>::type;
-		using type = typename meta::type;
+	template<int I, typename ...B> struct GetKeyFromValue<I, Dictionary<B...>> {
+		static constexpr std::size_t index{ detail::first_index<I, B::Value...>() };
+		static_assert(index < sizeof...(B), "CompileTimeDictionary: value does not exist in dictionary.");
+		using type = detail::nth<index, B...>;
 		enum { value = type::Key };
 	};
 	template<int I, typename A> inline constexpr int GetKeyFromValue_v = GetKeyFromValue<I, A>::value;
@@ -79,11 +103,8 @@ namespace CompileTimeDictionary {
 	* @param {out} true if key exists, false otherwise
 	**/
 	template<int I, typename A> struct ContainsKey;
-	template<int I, typename A> struct ContainsKey<I, Dictionary<A>> {
-		constexpr static bool Value{ I == A::Key };
-	};
-	template<int I, typename A, typename ... B> struct 	ContainsKey<I, Dictionary<A, B...>> {
-		constexpr static bool Value{ (I == A::Key) || ContainsKey<I, Dictionary<B...>>::Value };
+	template<int I, typename ...B> struct ContainsKey<I, Dictionary<B...>> {
+		constexpr static bool Value{ detail::first_index<I, B::Key...>() < sizeof...(B) };
 	};
 	template<int I, typename A> inline constexpr int ContainsKey_v = ContainsKey<I, A>::Value;
 
@@ -95,20 +116,353 @@ namespace CompileTimeDictionary {
 	* @param {out} true if value exists, false otherwise
 	**/
 	template<int I, typename A> struct ContainsValue;
-	template<int I, typename A> struct ContainsValue<I, Dictionary<A>> {
-		constexpr static bool Value{ I == A::Value };
-	};
-	template<int I, typename A, typename ... B> struct 	ContainsValue<I, Dictionary<A, B...>> {
-		constexpr static bool Value{ (I == A::Value) || ContainsValue<I, Dictionary<B...>>::Value };
+	template<int I, typename ...B> struct ContainsValue<I, Dictionary<B...>> {
+		constexpr static bool Value{ detail::first_index<I, B::Value...>() < sizeof...(B) };
 	};
 	template<int I, typename A> inline constexpr int ContainsValue_v = ContainsValue<I, A>::Value;
 }
 
+namespace CompileTimeDictionary {
+
+	//
+	// implementation of run time lookup
+	//
+	namespace detail {
+
+		// bijective 64bit mixer ('splitmix64' finalizer)
+		constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+			x ^= x >> 30;
+			x *= 0xBF58476D1CE4E5B9ull;
+			x ^= x >> 27;
+			x *= 0x94D049BB133111EBull;
+			x ^= x >> 31;
+			return x;
+		}
+
+		// smallest power of two which is not smaller than a given value
+		constexpr std::size_t ceil_pow2(const std::size_t x) noexcept {
+			std::size_t p{ 1 };
+			while (p < x) p <<= 1;
+			return p;
+		}
+
+		/**
+		* \brief minimal 'hash and displace' (CHD like) perfect hash over N distinct 64bit hashes.
+		*        hashes are split into buckets, and each bucket (largest first) is given a displacement
+		*        which places all its members in empty slots. a lookup is a bucket read followed by a slot read.
+		**/
+		template<std::size_t N> struct PerfectHash {
+			static constexpr std::size_t Slots{ ceil_pow2(2 * N) },
+			                             Buckets{ ceil_pow2((N + 3) / 4) },
+			                             Empty{ N };
+
+			std::array<std::uint32_t, Buckets> m_displacement;	// bucket -> displacement
+			std::array<std::size_t, Slots>     m_index;			// slot -> hashed entry index (or 'Empty')
+
+			static constexpr std::size_t bucket(const std::uint64_t h) noexcept { return static_cast<std::size_t>(h >> 32) & (Buckets - 1); }
+			static constexpr std::size_t slot(const std::uint64_t h, const std::uint64_t d) noexcept { return static_cast<std::size_t>(mix(h ^ (d * 0x9E3779B97F4A7C15ull))) & (Slots - 1); }
+
+			// slot of a given hash
+			constexpr std::size_t find(const std::uint64_t h) const noexcept { return slot(h, m_displacement[bucket(h)]); }
+		};
+
+		/**
+		* \brief build a perfect hash during compilation
+		*
+		* @param {array,        in}  hashes
+		* @param {Same,         in}  binary predicate which tests if two entries (given by index) have identical keys.
+		*                            entries with identical keys are placed once (first one wins),
+		*                            entries with identical hashes but different keys are a compilation error.
+		* @param {PerfectHash,  out} perfect hash
+		**/
+		template<std::size_t N, class Same> constexpr PerfectHash<N> make_perfect_hash(const std::array<std::uint64_t, N>& xi_hashes, Same&& xi_same) {
+			using hash_type = PerfectHash<N>;
+			constexpr std::size_t Buckets{ hash_type::Buckets };
+
+			hash_type table{};
+			for (std::size_t i{}; i < hash_type::Slots; ++i) table.m_index[i] = hash_type::Empty;
+
+			// entries grouped by bucket (stable, so the first of identical keys is placed first)
+			std::array<std::size_t, Buckets + 1> start{};
+			std::array<std::size_t, N>           members{};
+			for (std::size_t i{}; i < N; ++i) ++start[hash_type::bucket(xi_hashes[i]) + 1];
+			for (std::size_t b{}; b < Buckets; ++b) start[b + 1] += start[b];
+			std::array<std::size_t, Buckets + 1> fill{ start };
+			for (std::size_t i{}; i < N; ++i) members[fill[hash_type::bucket(xi_hashes[i])]++] = i;
+
+			// buckets ordered by decreasing size (counting sort)
+			std::array<std::size_t, N + 2>   bySize{};
+			std::array<std::size_t, Buckets> order{};
+			for (std::size_t b{}; b < Buckets; ++b) ++bySize[N - (start[b + 1] - start[b]) + 1];
+			for (std::size_t s{}; s <= N; ++s) bySize[s + 1] += bySize[s];
+			for (std::size_t b{}; b < Buckets; ++b) order[bySize[N - (start[b + 1] - start[b])]++] = b;
+
+			// place buckets
+			for (std::size_t o{}; o < Buckets; ++o) {
+				const std::size_t b{ order[o] };
+				if (start[b] == start[b + 1]) break;
+
+				for (std::uint32_t d{};; ++d) {
+					if (d == 0xFFFFF) throw std::logic_error("CompileTimeDictionary: failed building perfect hash.");
+
+					// tentatively place bucket members
+					bool placed{ true };
+					std::size_t last{ start[b] };
+					for (; last < start[b + 1]; ++last) {
+						const std::size_t i{ members[last] };
+
+						// skip members whose key was already placed by this bucket
+						bool duplicate{ false };
+						for (std::size_t j{ start[b] }; j < last; ++j) {
+							if (xi_hashes[members[j]] != xi_hashes[i]) continue;
+							if (!xi_same(members[j], i)) throw std::logic_error("CompileTimeDictionary: hash collision between different keys.");
+							duplicate = true;
+						}
+						if (duplicate) continue;
+
+						const std::size_t s{ hash_type::slot(xi_hashes[i], d) };
+						if (table.m_index[s] != hash_type::Empty) {
+							placed = false;
+							break;
+						}
+						table.m_index[s] = i;
+					}
+
+					if (placed) {
+						table.m_displacement[b] = d;
+						break;
+					}
+
+					// undo
+					for (std::size_t j{ start[b] }; j < last; ++j) {
+						const std::size_t s{ hash_type::slot(xi_hashes[members[j]], d) };
+						if (table.m_index[s] == members[j]) table.m_index[s] = hash_type::Empty;
+					}
+				}
+			}
+
+			return table;
+		}
+
+		// dense lookup table (used when keys span a small range)
+		template<std::size_t R> struct DenseTable {
+			std::array<int, R>  m_value;
+			std::array<bool, R> m_present;
+		};
+
+		// perfect hash lookup table
+		template<std::size_t N> struct HashTable {
+			PerfectHash<N>                          m_hash;
+			std::array<int, PerfectHash<N>::Slots>  m_key;
+			std::array<int, PerfectHash<N>::Slots>  m_value;
+			std::array<bool, PerfectHash<N>::Slots> m_present;
+		};
+
+		/**
+		* \brief run time 'From' -> 'To' lookup, built entirely during compilation
+		*        (a dense table if 'From' spans a small range, otherwise a perfect hash)
+		**/
+		template<typename From, typename To> struct Lookup;
+		template<int ...From, int ...To> struct Lookup<std::integer_sequence<int, From...>, std::integer_sequence<int, To...>> {
+			static constexpr std::size_t N{ sizeof...(From) };
+
+			// key range
+			// (entries are iterated rather than indexed, which is considerably faster to evaluate during compilation)
+			static constexpr std::int64_t bound(const bool xi_min) noexcept {
+				std::int64_t value{};
+				bool first{ true };
+				for (const std::int64_t x : std::initializer_list<std::int64_t>{ From... }) {
+					value = first ? x : (xi_min ? std::min(value, x) : std::max(value, x));
+					first = false;
+				}
+				return value;
+			}
+			static constexpr std::int64_t Min{ bound(true) },
+			                              Max{ bound(false) };
+			static constexpr bool         Dense{ static_cast<std::uint64_t>(Max - Min) < 2 * N + 16 };
+			static constexpr std::size_t  Range{ Dense ? static_cast<std::size_t>(Max - Min + 1) : 1 };
+
+			static constexpr auto build() {
+				if constexpr (Dense) {
+					DenseTable<Range> table{};
+					for (const auto& [x, y] : std::initializer_list<std::pair<int, int>>{ { From, To }... }) {
+						const std::size_t i{ static_cast<std::size_t>(x - Min) };
+						if (table.m_present[i]) continue;
+						table.m_value[i]   = y;
+						table.m_present[i] = true;
+					}
+					return table;
+				}
+				else {
+					std::array<std::uint64_t, N> hashes{};
+					std::size_t i{};
+					for (const int x : std::initializer_list<int>{ From... }) hashes[i++] = mix(static_cast<std::uint32_t>(x));
+
+					HashTable<N> table{};
+					table.m_hash = make_perfect_hash(hashes, [](std::size_t, std::size_t) { return true; });
+					i = 0;
+					for (const auto& [x, y] : std::initializer_list<std::pair<int, int>>{ { From, To }... }) {
+						const std::size_t s{ table.m_hash.find(hashes[i]) };
+						if (table.m_hash.m_index[s] == i) {
+							table.m_key[s]     = x;
+							table.m_value[s]   = y;
+							table.m_present[s] = true;
+						}
+						++i;
+					}
+					return table;
+				}
+			}
+			static constexpr auto table{ build() };
+
+			static constexpr std::optional<int> find(const int x) noexcept {
+				if constexpr (Dense) {
+					const std::uint64_t i{ static_cast<std::uint64_t>(static_cast<std::int64_t>(x) - Min) };
+					return ((i < Range) && table.m_present[i]) ? std::optional<int>(table.m_value[i]) : std::nullopt;
+				}
+				else {
+					const std::size_t s{ table.m_hash.find(mix(static_cast<std::uint32_t>(x))) };
+					return (table.m_present[s] & (table.m_key[s] == x)) ? std::optional<int>(table.m_value[s]) : std::nullopt;
+				}
+			}
+		};
+	}
+
+	/**
+	* \brief dictionary definition.
+	*        besides compile time queries, a dictionary supports O(1) run time lookup (in both directions)
+	*        using tables which are built during compilation (no run time initialization).
+	**/
+	template<typename ...Entrys> struct Dictionary {
+
+		/**
+		* \brief given a (run time) key, return its value
+		*
+		* @param {int,      in}  key
+		* @param {optional, out} value (empty if key does not exist in dictionary)
+		**/
+		static constexpr std::optional<int> lookup(const int key) noexcept {
+			return detail::Lookup<std::integer_sequence<int, Entrys::Key...>, std::integer_sequence<int, Entrys::Value...>>::find(key);
+		}
+
+		/**
+		* \brief given a (run time) value, return its key (if several keys share the value - the first one)
+		*
+		* @param {int,      in}  value
+		* @param {optional, out} key (empty if value does not exist in dictionary)
+		**/
+		static constexpr std::optional<int> reverse_lookup(const int value) noexcept {
+			return detail::Lookup<std::integer_sequence<int, Entrys::Value...>, std::integer_sequence<int, Entrys::Key...>>::find(value);
+		}
+	};
+}
+
+// string keyed dictionary (requires class type non-type template parameters, i.e. - C++20)
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+namespace CompileTimeDictionary {
+
+	/**
+	* \brief a string literal which can be used as a template parameter
+	**/
+	template<std::size_t N> struct FixedString {
+		char m_data[N];
+
+		constexpr FixedString(const char(&xi_string)[N]) noexcept : m_data{} {
+			for (std::size_t i{}; i < N; ++i) m_data[i] = xi_string[i];
+		}
+
+		constexpr std::string_view view() const noexcept { return std::string_view(m_data, N - 1); }
+	};
+
+	/**
+	* \brief string dictionary is composed of string entries.
+	*        each entry is defined by <key, value> pair.
+	*        usage is: using dict = StringDictionary<StringEntry<"x1", y1>, StringEntry<"x2", y2>, ...>;
+	**/
+	template<FixedString K, int V> struct StringEntry {
+		static constexpr std::string_view Key{ K.view() };
+		enum { Value = V };
+	};
+
+	//
+	// implementation of string dictionary run time lookup
+	//
+	namespace detail {
+
+		// string hash ('FNV-1a' followed by a 64bit mixer)
+		constexpr std::uint64_t hash(const std::string_view xi_string) noexcept {
+			std::uint64_t h{ 0xCBF29CE484222325ull };
+			for (const char c : xi_string) {
+				h ^= static_cast<unsigned char>(c);
+				h *= 0x100000001B3ull;
+			}
+			return mix(h);
+		}
+
+		// perfect hash lookup table over string keys
+		template<std::size_t N> struct StringHashTable {
+			PerfectHash<N>                                      m_hash;
+			std::array<std::string_view, PerfectHash<N>::Slots> m_key;
+			std::array<int, PerfectHash<N>::Slots>              m_value;
+			std::array<bool, PerfectHash<N>::Slots>             m_present;
+		};
+
+		template<std::size_t N> constexpr StringHashTable<N> make_string_table(const std::array<std::string_view, N>& xi_keys, const std::array<int, N>& xi_values) {
+			std::array<std::uint64_t, N> hashes{};
+			for (std::size_t i{}; i < N; ++i) hashes[i] = hash(xi_keys[i]);
+
+			StringHashTable<N> table{};
+			table.m_hash = make_perfect_hash(hashes, [&xi_keys](const std::size_t i, const std::size_t j) { return xi_keys[i] == xi_keys[j]; });
+			for (std::size_t i{}; i < N; ++i) {
+				const std::size_t s{ table.m_hash.find(hashes[i]) };
+				if (table.m_hash.m_index[s] != i) continue;
+				table.m_key[s]     = xi_keys[i];
+				table.m_value[s]   = xi_values[i];
+				table.m_present[s] = true;
+			}
+			return table;
+		}
+	}
+
+	/**
+	* \brief string keyed dictionary definition.
+	*        lookup is a single hash, a single key comparison and no allocation,
+	*        using a perfect hash which is built during compilation.
+	**/
+	template<typename ...Entrys> struct StringDictionary {
+		static constexpr std::size_t N{ sizeof...(Entrys) };
+		static constexpr auto table{ detail::make_string_table<N>({ Entrys::Key... }, { Entrys::Value... }) };
+
+		/**
+		* \brief given a (run time) key, return its value
+		*
+		* @param {string_view, in}  key
+		* @param {optional,    out} value (empty if key does not exist in dictionary; if several entries share the key - the first one)
+		**/
+		static constexpr std::optional<int> lookup(const std::string_view key) noexcept {
+			const std::size_t s{ table.m_hash.find(detail::hash(key)) };
+			return (table.m_present[s] && (table.m_key[s] == key)) ? std::optional<int>(table.m_value[s]) : std::nullopt;
+		}
+
+		/**
+		* \brief test if a given (run time) key exists in dictionary
+		*
+		* @param {string_view, in}  key
+		* @param {bool,        out} true if key exists, false otherwise
+		**/
+		static constexpr bool contains(const std::string_view key) noexcept { return lookup(key).has_value(); }
+	};
+
+	template<typename ...B> struct size<StringDictionary<B...>> { enum { Value = sizeof...(B) }; };
+}
+#endif
+
 //////////////////////////////////////////////////
 //////////////// example usage ///////////////////
 //////////////////////////////////////////////////
 
 #include "Dictionary.h"
+#include <cstdlib>
 #include <iostream>
 
 // test compile time dictionary
@@ -143,6 +497,29 @@ int main() {
 	static_assert(ContainsValue_v<15, M> == true);
 	static_assert(ContainsValue_v<37, M> == false);
 
+	// run time lookup (O(1), no run time initialization)
+	static_assert(M::lookup(1) == 8);
+	static_assert(M::reverse_lookup(15) == 2);
+	static_assert(M::lookup(37).has_value() == false);
+
+	const int key{ std::rand() % 3 };
+	std::cout << "M::lookup(" << key << ") = " << M::lookup(key).value_or(-1) << std::endl;
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+	// string keyed dictionary
+	using S = StringDictionary<StringEntry<"host", 0>,
+							   StringEntry<"content-type", 1>,
+							   StringEntry<"content-length", 2>,
+							   StringEntry<"user-agent", 3>>;
+	static_assert(size_v<S> == 4);
+	static_assert(S::lookup("content-length") == 2);
+	static_assert(S::lookup("accept").has_value() == false);
+	static_assert(S::contains("user-agent"));
+
+	const std::string_view field{ "host" };
+	std::cout << "S::lookup(" << field << ") = " << S::lookup(field).value_or(-1) << std::endl;
+#endif
+
 	// output
 	std::cout << "dictionary size is" << size_v<M> << std::endl;
 
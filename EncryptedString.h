@@ -1,6 +1,6 @@
 /**
 * A small utility which allows compile time encryption and run time decryption of strings.
-* Encryption/Decryption schemes are supplied by the user (default is XOR encryption).
+* Encryption/Decryption schemes are supplied by the user (default is a counter mode ARX keystream).
 * 
 * example usage:
 * ```c
@@ -11,75 +11,482 @@
 * // decrypt string during run time
 * auto encrypted_string = DecryptString(decrypted_string);
 * std::cout << "run time decrypted: " << encrypted_string << std::endl;
+*
+* // decrypt into a scoped (stack) buffer, leaving the encrypted object untouched.
+* // the plain text is wiped when the accessor goes out of scope.
+* {
+*     const auto plain = decrypted_string.Scoped();
+*     std::cout << "scoped decrypted: " << plain.view() << std::endl;
+* }
+*
+* // several strings packed into a single compile time encrypted blob, decrypted once (at startup)
+* // into a read only page, after which each string is a 'string_view' with no per use overhead
+* enum Strings : std::size_t { Host, User, Query };
+* static constexpr auto table = EncryptStringTable("db.example.com", "admin", "SELECT * FROM t");
+* static const DecryptedStringTable strings(table);
+* std::cout << strings[Host] << std::endl;
 * ```
-* 
+*
 * Dan Israel Malta
 **/
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
-// create a numerical value from/during compilation time
-struct CompileTimeSeed {
-    static constexpr std::uint64_t value = (__TIME__[7] - '0') * 1u    +
-                                           (__TIME__[6] - '0') * 10u   +
-                                           (__TIME__[4] - '0') * 60u   +
-                                           (__TIME__[3] - '0') * 600u  +
-                                           (__TIME__[1] - '0') * 3600u +
-                                           (__TIME__[0] - '0') * 36000u;
-};
+#if defined(__unix__) || defined(__APPLE__)
+#define ENCRYPTED_STRING_POSIX_PAGES
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define ENCRYPTED_STRING_WINDOWS_PAGES
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
 
-// one step linear congruential pseudo random number generator (modulus is 2^32 = 0xFFFFFFFF)
-template<std::uint64_t Multiplier, std::uint64_t Incerement> struct RandomGenerator {
-    static constexpr std::uint32_t value{ static_cast<std::uint32_t>((Incerement + Multiplier * CompileTimeSeed::value) & 0xFFFFFFFF) };
-};
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENCRYPTED_STRING_SIMD
+#include <emmintrin.h>
+#endif
 
-// 'incremental' pseudo random number
-struct Random {
-    static constexpr std::uint32_t value{ RandomGenerator<1664525u, 1013904223u>::value };
-};
+// counter mode ARX (add-rotate-xor) keystream, same structure as ChaCha with 8 rounds
+namespace EncryptedStringDetail {
 
-// return a pseudo random number within a given region
-template<std::uint32_t min, std::uint32_t max> struct RandomInRange {
-    static constexpr std::uint32_t value{ min + (Random::value % (max - min + 1)) };
-};
+	// overwrite a buffer such that the compiler can not elide the writes
+	inline void SecureWipe(char* xo_buffer, const std::size_t xi_size) noexcept {
+		volatile char* p{ xo_buffer };
+		std::size_t i{};
+#ifdef ENCRYPTED_STRING_SIMD
+		// 16 bytes at a time once the buffer is aligned
+		for (; (i < xi_size) && (reinterpret_cast<std::uintptr_t>(xo_buffer + i) % 16 != 0); ++i) p[i] = 0;
+		volatile __m128i* blocks{ reinterpret_cast<volatile __m128i*>(xo_buffer + i) };
+		for (std::size_t j{}; i + 16 <= xi_size; i += 16, ++j) blocks[j] = _mm_setzero_si128();
+#endif
+		for (; i < xi_size; ++i) p[i] = 0;
+	}
 
-// return a random character
-struct RandomCharacter {
-    static constexpr char value{ static_cast<char>(RandomInRange<0, 255>::value) };
-};
+	// 64bit FNV-1a hash of a string
+	constexpr std::uint64_t Fnv(const char* xi_string) {
+		std::uint64_t h{ 0xCBF29CE484222325ull };
+		for (; *xi_string != '\0'; ++xi_string) {
+			h ^= static_cast<unsigned char>(*xi_string);
+			h *= 0x100000001B3ull;
+		}
+		return h;
+	}
+
+	// 'splitmix64' step
+	constexpr std::uint64_t SplitMix(std::uint64_t& xio_state) {
+		std::uint64_t z{ xio_state += 0x9E3779B97F4A7C15ull };
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	// 256bit key and 64bit nonce, derived from a seed.
+	// the seed is a template parameter (and not a header level constant) since each translation unit encrypts with its
+	// own compilation date and time, and must decrypt using the same key and not the one the linker happened to keep.
+	template<std::uint64_t Seed> struct ArxKey {
+		std::uint32_t words[10];
+
+		constexpr ArxKey() : words{} {
+			std::uint64_t state{ Seed };
+			for (std::size_t i{}; i < 10; i += 2) {
+				const std::uint64_t r{ SplitMix(state) };
+				words[i]     = static_cast<std::uint32_t>(r);
+				words[i + 1] = static_cast<std::uint32_t>(r >> 32);
+			}
+		}
+	};
+	template<std::uint64_t Seed> inline constexpr ArxKey<Seed> Key{};
+
+	constexpr std::uint32_t RotateLeft(const std::uint32_t x, const int n) { return (x << n) | (x >> (32 - n)); }
+
+	constexpr void QuarterRound(std::uint32_t& a, std::uint32_t& b, std::uint32_t& c, std::uint32_t& d) {
+		a += b; d = RotateLeft(d ^ a, 16);
+		c += d; b = RotateLeft(b ^ c, 12);
+		a += b; d = RotateLeft(d ^ a, 8);
+		c += d; b = RotateLeft(b ^ c, 7);
+	}
+
+	// initial state of a given keystream block
+	template<std::uint64_t Seed> constexpr std::array<std::uint32_t, 16> ArxState(const std::uint64_t xi_block) {
+		return { 0x61707865u, 0x3320646Eu, 0x79622D32u, 0x6B206574u,
+		         Key<Seed>.words[0], Key<Seed>.words[1], Key<Seed>.words[2], Key<Seed>.words[3],
+		         Key<Seed>.words[4], Key<Seed>.words[5], Key<Seed>.words[6], Key<Seed>.words[7],
+		         static_cast<std::uint32_t>(xi_block), static_cast<std::uint32_t>(xi_block >> 32),
+		         Key<Seed>.words[8], Key<Seed>.words[9] };
+	}
+
+	// keystream block (64 bytes, as 16 little endian words)
+	template<std::uint64_t Seed> constexpr std::array<std::uint32_t, 16> ArxBlock(const std::uint64_t xi_block) {
+		const std::array<std::uint32_t, 16> input{ ArxState<Seed>(xi_block) };
+		std::array<std::uint32_t, 16> x{ input };
+		for (int round{}; round < 8; round += 2) {
+			QuarterRound(x[0], x[4], x[8], x[12]);
+			QuarterRound(x[1], x[5], x[9], x[13]);
+			QuarterRound(x[2], x[6], x[10], x[14]);
+			QuarterRound(x[3], x[7], x[11], x[15]);
+			QuarterRound(x[0], x[5], x[10], x[15]);
+			QuarterRound(x[1], x[6], x[11], x[12]);
+			QuarterRound(x[2], x[7], x[8], x[13]);
+			QuarterRound(x[3], x[4], x[9], x[14]);
+		}
+		for (std::size_t i{}; i < 16; ++i) x[i] += input[i];
+		return x;
+	}
+
+#ifdef ENCRYPTED_STRING_SIMD
+	// four consecutive keystream blocks (256 bytes), each SSE2 lane holds a different block
+	template<std::uint64_t Seed> void ArxBlocks4(const std::uint64_t xi_block, std::uint8_t* xo_key) noexcept {
+		const std::array<std::uint32_t, 16> state{ ArxState<Seed>(xi_block) };
+
+		__m128i input[16];
+		for (std::size_t i{}; i < 16; ++i) input[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+		input[12] = _mm_setr_epi32(static_cast<int>(xi_block), static_cast<int>(xi_block + 1), static_cast<int>(xi_block + 2), static_cast<int>(xi_block + 3));
+		input[13] = _mm_setr_epi32(static_cast<int>(xi_block >> 32), static_cast<int>((xi_block + 1) >> 32), static_cast<int>((xi_block + 2) >> 32), static_cast<int>((xi_block + 3) >> 32));
+
+		__m128i x[16];
+		for (std::size_t i{}; i < 16; ++i) x[i] = input[i];
+
+		const auto rotate = [](const __m128i v, const int n) { return _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - n)); };
+		const auto quarter = [&x, &rotate](const int a, const int b, const int c, const int d) {
+			x[a] = _mm_add_epi32(x[a], x[b]); x[d] = rotate(_mm_xor_si128(x[d], x[a]), 16);
+			x[c] = _mm_add_epi32(x[c], x[d]); x[b] = rotate(_mm_xor_si128(x[b], x[c]), 12);
+			x[a] = _mm_add_epi32(x[a], x[b]); x[d] = rotate(_mm_xor_si128(x[d], x[a]), 8);
+			x[c] = _mm_add_epi32(x[c], x[d]); x[b] = rotate(_mm_xor_si128(x[b], x[c]), 7);
+		};
+		for (int round{}; round < 8; round += 2) {
+			quarter(0, 4, 8, 12);
+			quarter(1, 5, 9, 13);
+			quarter(2, 6, 10, 14);
+			quarter(3, 7, 11, 15);
+			quarter(0, 5, 10, 15);
+			quarter(1, 6, 11, 12);
+			quarter(2, 7, 8, 13);
+			quarter(3, 4, 9, 14);
+		}
+
+		// transpose (word major -> block major) and store
+		for (std::size_t g{}; g < 16; g += 4) {
+			const __m128i a{ _mm_add_epi32(x[g], input[g]) },
+			              b{ _mm_add_epi32(x[g + 1], input[g + 1]) },
+			              c{ _mm_add_epi32(x[g + 2], input[g + 2]) },
+			              d{ _mm_add_epi32(x[g + 3], input[g + 3]) },
+			              ab0{ _mm_unpacklo_epi32(a, b) }, ab1{ _mm_unpackhi_epi32(a, b) },
+			              cd0{ _mm_unpacklo_epi32(c, d) }, cd1{ _mm_unpackhi_epi32(c, d) };
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key +   0 + 4 * g), _mm_unpacklo_epi64(ab0, cd0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key +  64 + 4 * g), _mm_unpackhi_epi64(ab0, cd0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key + 128 + 4 * g), _mm_unpacklo_epi64(ab1, cd1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key + 192 + 4 * g), _mm_unpackhi_epi64(ab1, cd1));
+		}
+	}
+#endif
+
+	/**
+	* short literals (up to 'ShortLength' bytes) are placed at stream positions whose 'ShortStream' bit is set, where the
+	* keystream is generated 16 bytes at a time by an ARX permutation of four words (key and counter), so a short literal
+	* costs a few quarter rounds instead of a whole 64 byte block.
+	**/
+	inline constexpr std::uint64_t ShortStream{ std::uint64_t{ 1 } << 63 };
+	inline constexpr std::size_t   ShortLength{ 64 };
+
+	constexpr bool IsShortStream(const std::uint64_t xi_position) { return (xi_position & ShortStream) != 0; }
+
+	// stream position of a literal of a given size
+	constexpr std::uint64_t LiteralPosition(const std::uint64_t xi_position, const std::size_t xi_size) {
+		return (xi_position & ~ShortStream) | ((xi_size <= ShortLength) ? ShortStream : 0);
+	}
+
+	// short stream keystream block (16 bytes, as 4 little endian words)
+	template<std::uint64_t Seed> constexpr std::array<std::uint32_t, 4> ArxShortBlock(const std::uint64_t xi_block) {
+		std::uint32_t a{ Key<Seed>.words[0] + static_cast<std::uint32_t>(xi_block) },
+		              b{ Key<Seed>.words[1] + static_cast<std::uint32_t>(xi_block >> 32) },
+		              c{ Key<Seed>.words[2] ^ 0x61707865u },
+		              d{ Key<Seed>.words[3] ^ 0x3320646Eu };
+		for (std::uint32_t round{}; round < 8; ++round) {
+			d ^= round;
+			QuarterRound(a, b, c, d);
+		}
+		return { a + Key<Seed>.words[4], b + Key<Seed>.words[5], c + Key<Seed>.words[6], d + Key<Seed>.words[7] };
+	}
+
+#ifdef ENCRYPTED_STRING_SIMD
+	// four consecutive short stream blocks (64 bytes, starting at short block '4 * xi_block'), each SSE2 lane holds a different block
+	template<std::uint64_t Seed> void ArxShortBlocks4(const std::uint64_t xi_block, std::uint8_t* xo_key) noexcept {
+		const std::uint64_t first{ xi_block * 4 };
+		__m128i a{ _mm_add_epi32(_mm_set1_epi32(static_cast<int>(Key<Seed>.words[0])),
+		                         _mm_setr_epi32(static_cast<int>(first), static_cast<int>(first + 1), static_cast<int>(first + 2), static_cast<int>(first + 3))) },
+		        b{ _mm_add_epi32(_mm_set1_epi32(static_cast<int>(Key<Seed>.words[1])),
+		                         _mm_setr_epi32(static_cast<int>(first >> 32), static_cast<int>((first + 1) >> 32), static_cast<int>((first + 2) >> 32), static_cast<int>((first + 3) >> 32))) },
+		        c{ _mm_set1_epi32(static_cast<int>(Key<Seed>.words[2] ^ 0x61707865u)) },
+		        d{ _mm_set1_epi32(static_cast<int>(Key<Seed>.words[3] ^ 0x3320646Eu)) };
+
+		const auto rotate = [](const __m128i v, const int n) { return _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - n)); };
+		for (int round{}; round < 8; ++round) {
+			d = _mm_xor_si128(d, _mm_set1_epi32(round));
+			a = _mm_add_epi32(a, b); d = rotate(_mm_xor_si128(d, a), 16);
+			c = _mm_add_epi32(c, d); b = rotate(_mm_xor_si128(b, c), 12);
+			a = _mm_add_epi32(a, b); d = rotate(_mm_xor_si128(d, a), 8);
+			c = _mm_add_epi32(c, d); b = rotate(_mm_xor_si128(b, c), 7);
+		}
+		a = _mm_add_epi32(a, _mm_set1_epi32(static_cast<int>(Key<Seed>.words[4])));
+		b = _mm_add_epi32(b, _mm_set1_epi32(static_cast<int>(Key<Seed>.words[5])));
+		c = _mm_add_epi32(c, _mm_set1_epi32(static_cast<int>(Key<Seed>.words[6])));
+		d = _mm_add_epi32(d, _mm_set1_epi32(static_cast<int>(Key<Seed>.words[7])));
+
+		// transpose (word major -> block major) and store
+		const __m128i ab0{ _mm_unpacklo_epi32(a, b) }, ab1{ _mm_unpackhi_epi32(a, b) },
+		              cd0{ _mm_unpacklo_epi32(c, d) }, cd1{ _mm_unpackhi_epi32(c, d) };
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key +  0), _mm_unpacklo_epi64(ab0, cd0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key + 16), _mm_unpackhi_epi64(ab0, cd0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key + 32), _mm_unpacklo_epi64(ab1, cd1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_key + 48), _mm_unpackhi_epi64(ab1, cd1));
+	}
+#endif
+
+	// keystream byte 'i' of a keystream block
+	template<std::size_t N> constexpr std::uint8_t ArxByte(const std::array<std::uint32_t, N>& xi_block, const std::size_t i) {
+		return static_cast<std::uint8_t>(xi_block[i / 4] >> (8 * (i % 4)));
+	}
+
+	// copy 'count' bytes, starting at byte 'first', of a keystream block
+	template<std::size_t N> void ArxExtract(const std::array<std::uint32_t, N>& block, const std::size_t xi_first, std::uint8_t* xo_key, const std::size_t xi_count) noexcept {
+		for (std::size_t j{}; j < xi_count; ++j) {
+			xo_key[j] = ArxByte(block, xi_first + j);
+		}
+	}
+}
 
 /**
 * A base object which holds the encryption & decryption scheme's to be used during encryption/decryption.
-* Encryption schema should have the signature: char = Encryption(char, uint8_t)
-* Decryption schema should have the signature: char = Decryption(char, uint8_t)
-* Notice that it should work on a singe character.
+* Encryption schema should have the signature: char = Encryption(char, uint64_t)
+* Decryption schema should have the signature: char = Decryption(char, uint64_t)
+* Notice that it should work on a singe character, whose position in the encrypted stream is given as second argument.
+*
+* A schema which is a XOR keystream may also supply:
+*   void Keystream(uint64_t position, uint8_t* key, size_t count) - fill 'count' keystream bytes starting at 'position'
+* in which case run time decryption is performed block wise instead of character by character, and:
+*   constexpr array<uint8_t, 64> KeystreamBlock(uint64_t block) - keystream bytes [64 * block, 64 * block + 64)
+* in which case compile time encryption generates each keystream block once instead of once per character.
+*
+* The default schema is a counter mode ARX keystream (ChaCha structure, 8 rounds) whose key is derived from a seed
+* (the 'EncryptString' macros use the compilation date and time, see 'ENCRYPTED_STRING_SEED'). the seed is part of
+* the schema type, so strings of different translation units are decrypted with their own key.
+* it is evaluated during compilation for encryption, and four blocks at a time (SSE2) during run time decryption.
+* literals of up to 64 bytes use a 'short stream' of 16 byte blocks (a four word ARX permutation, four blocks per SSE2
+* call), so decrypting a short literal does not cost a whole 64 byte block.
+* Notice that the key is embedded in the binary, so this is obfuscation and not a protection against a determined attacker.
 *
 * User editable...
 **/
-struct EncryptionSchema {
+template<std::uint64_t Seed> struct EncryptionSchema {
 	// character encryption scheme
-	static constexpr char Encryption(const char chr, const std::uint8_t id) {
-		return (chr ^ (RandomCharacter::value + id));
+	static constexpr char Encryption(const char chr, const std::uint64_t id) {
+		return static_cast<char>(chr ^ Key(id));
 	}
 
 	// character decryption scheme
-	static constexpr char Decryption(const char chr, const std::uint32_t id) {
-		return (chr ^ (RandomCharacter::value + id));
+	static constexpr char Decryption(const char chr, const std::uint64_t id) {
+		return static_cast<char>(chr ^ Key(id));
+	}
+
+	// keystream byte at a given position
+	static constexpr std::uint8_t Key(const std::uint64_t id) {
+		if (EncryptedStringDetail::IsShortStream(id)) return EncryptedStringDetail::ArxByte(EncryptedStringDetail::ArxShortBlock<Seed>(id / 16), id % 16);
+		return EncryptedStringDetail::ArxByte(EncryptedStringDetail::ArxBlock<Seed>(id / 64), id % 64);
+	}
+
+	// keystream block (compile time)
+	static constexpr std::array<std::uint8_t, 64> KeystreamBlock(const std::uint64_t block) {
+		std::array<std::uint8_t, 64> key{};
+		if (EncryptedStringDetail::IsShortStream(block * 64)) {
+			for (std::size_t q{}; q < 4; ++q) {
+				const std::array<std::uint32_t, 4> words{ EncryptedStringDetail::ArxShortBlock<Seed>(block * 4 + q) };
+				for (std::size_t i{}; i < 16; ++i) key[q * 16 + i] = EncryptedStringDetail::ArxByte(words, i);
+			}
+		}
+		else {
+			const std::array<std::uint32_t, 16> words{ EncryptedStringDetail::ArxBlock<Seed>(block) };
+			for (std::size_t i{}; i < 64; ++i) key[i] = EncryptedStringDetail::ArxByte(words, i);
+		}
+		return key;
+	}
+
+	// keystream block
+	static void Keystream(const std::uint64_t position, std::uint8_t* key, const std::size_t count) {
+		std::size_t i{};
+
+		// short stream - four 16 byte blocks at a time (SSE2), otherwise only the 16 byte blocks which are needed
+		if (EncryptedStringDetail::IsShortStream(position)) {
+#ifdef ENCRYPTED_STRING_SIMD
+			alignas(16) std::uint8_t block[64];
+			for (; i < count;) {
+				const std::size_t first{ static_cast<std::size_t>((position + i) % 64) },
+				                  size{ (64 - first < count - i) ? 64 - first : count - i };
+				EncryptedStringDetail::ArxShortBlocks4<Seed>((position + i) / 64, block);
+				for (std::size_t j{}; j < size; ++j) key[i + j] = block[first + j];
+				i += size;
+			}
+			EncryptedStringDetail::SecureWipe(reinterpret_cast<char*>(block), sizeof(block));
+#else
+			for (; i < count;) {
+				const std::size_t first{ static_cast<std::size_t>((position + i) % 16) },
+				                  size{ (16 - first < count - i) ? 16 - first : count - i };
+				EncryptedStringDetail::ArxExtract(EncryptedStringDetail::ArxShortBlock<Seed>((position + i) / 16), first, key + i, size);
+				i += size;
+			}
+#endif
+			return;
+		}
+
+		// partial leading block
+		if (position % 64 != 0) {
+			const std::size_t first{ static_cast<std::size_t>(position % 64) };
+			i = (64 - first < count) ? 64 - first : count;
+			EncryptedStringDetail::ArxExtract(EncryptedStringDetail::ArxBlock<Seed>(position / 64), first, key, i);
+		}
+
+#ifdef ENCRYPTED_STRING_SIMD
+		for (; i + 256 <= count; i += 256) {
+			EncryptedStringDetail::ArxBlocks4<Seed>((position + i) / 64, key + i);
+		}
+#endif
+
+		for (; i < count; i += 64) {
+			EncryptedStringDetail::ArxExtract(EncryptedStringDetail::ArxBlock<Seed>((position + i) / 64), 0, key + i, (count - i < 64) ? count - i : 64);
+		}
 	}
 };
 
 // type trait to see if the method 'Encryption' is included in a struct
 template<typename T, typename = void> struct has_Encryption_method : std::false_type { };
-template<typename T> struct has_Encryption_method<T, decltype(std::declval<T>().Encryption, void())> : std::true_type { };
+template<typename T> struct has_Encryption_method<T, decltype(&T::Encryption, void())> : std::true_type { };
 
 // type trait to see if the method 'Decryption' is included in a struct
 template<typename T, typename = void> struct has_Decryption_method : std::false_type { };
-template<typename T> struct has_Decryption_method<T, decltype(std::declval<T>().Decryption, void())> : std::true_type { };
+template<typename T> struct has_Decryption_method<T, decltype(&T::Decryption, void())> : std::true_type { };
+
+// type trait to see if the method 'Keystream' is included in a struct
+template<typename T, typename = void> struct has_Keystream_method : std::false_type { };
+template<typename T> struct has_Keystream_method<T, decltype(&T::Keystream, void())> : std::true_type { };
+
+// type trait to see if the method 'KeystreamBlock' is included in a struct
+template<typename T, typename = void> struct has_KeystreamBlock_method : std::false_type { };
+template<typename T> struct has_KeystreamBlock_method<T, decltype(&T::KeystreamBlock, void())> : std::true_type { };
+
+namespace EncryptedStringDetail {
+
+	/**
+	* \brief encrypt a buffer using a given schema (compile time)
+	*
+	* @param {char*,  in}  plain characters
+	* @param {char*,  out} encrypted characters
+	* @param {size_t, in}  amount of characters
+	* @param {size_t, in}  position of first character in encrypted stream
+	**/
+	template<class Logic> constexpr void Encrypt(const char* xi_in, char* xo_out, const std::size_t xi_count, const std::uint64_t xi_position) {
+		if constexpr (has_KeystreamBlock_method<Logic>::value) {
+			// each keystream block is generated once, and XOR'ed with the (up to) 64 characters it covers
+			for (std::size_t i{}; i < xi_count;) {
+				const std::uint64_t position{ xi_position + i };
+				const std::array<std::uint8_t, 64> key{ Logic::KeystreamBlock(position / 64) };
+				for (std::size_t j{ static_cast<std::size_t>(position % 64) }; (j < 64) && (i < xi_count); ++j, ++i) {
+					xo_out[i] = static_cast<char>(xi_in[i] ^ key[j]);
+				}
+			}
+		}
+		else {
+			for (std::size_t i{}; i < xi_count; ++i) {
+				xo_out[i] = Logic::Encryption(xi_in[i], xi_position + i);
+			}
+		}
+	}
+
+	/**
+	* \brief decrypt a buffer using a given schema ('xo_out' may alias 'xi_in')
+	*
+	* @param {char*,  in}  encrypted characters
+	* @param {char*,  out} decrypted characters
+	* @param {size_t, in}  amount of characters
+	* @param {size_t, in}  position of first character in encrypted stream
+	**/
+	template<class Logic> void Decrypt(const char* xi_in, char* xo_out, const std::size_t xi_count, const std::uint64_t xi_position = 0) noexcept {
+		if constexpr (has_Keystream_method<Logic>::value) {
+			// keystream is generated in chunks (on the stack) and XOR'ed block wise
+			constexpr std::size_t Chunk{ 256 };
+			alignas(16) std::uint8_t key[Chunk];
+
+			// chunks end on a 64 byte keystream position, so only the first chunk starts at a partial keystream block
+			for (std::size_t first{}, count{}; first < xi_count; first += count) {
+				count = Chunk - static_cast<std::size_t>((xi_position + first) % 64);
+				if (xi_count - first < count) count = xi_count - first;
+				Logic::Keystream(xi_position + first, key, count);
+
+				std::size_t i{};
+#ifdef ENCRYPTED_STRING_SIMD
+				for (; i + 16 <= count; i += 16) {
+					const __m128i data{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(xi_in + first + i)) },
+					              k{ _mm_load_si128(reinterpret_cast<const __m128i*>(key + i)) };
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(xo_out + first + i), _mm_xor_si128(data, k));
+				}
+#endif
+				for (; i < count; ++i) {
+					xo_out[first + i] = static_cast<char>(xi_in[first + i] ^ key[i]);
+				}
+			}
+
+			SecureWipe(reinterpret_cast<char*>(key), (xi_count < Chunk) ? xi_count : Chunk);
+		}
+		else {
+			for (std::size_t i{}; i < xi_count; ++i) {
+				xo_out[i] = Logic::Decryption(xi_in[i], xi_position + i);
+			}
+		}
+	}
+}
+
+/**
+* scoped accessor to a decrypted string.
+* holds the plain text in its own (stack) storage, and wipes it on destruction.
+**/
+template<std::size_t N> class ScopedDecryptedString {
+	// properties
+	private:
+		char m_plain[N + 1];
+
+	// constructor
+	public:
+		template<class Logic> ScopedDecryptedString(const char* xi_encrypted, const std::uint64_t xi_position, Logic*) noexcept {
+			EncryptedStringDetail::Decrypt<Logic>(xi_encrypted, m_plain, N, xi_position);
+			m_plain[N] = '\0';
+		}
+
+		~ScopedDecryptedString() { EncryptedStringDetail::SecureWipe(m_plain, N + 1); }
+
+		ScopedDecryptedString(const ScopedDecryptedString&)            = delete;
+		ScopedDecryptedString& operator=(const ScopedDecryptedString&) = delete;
+
+	// API
+	public:
+		const char* c_str() const noexcept { return m_plain; }
+		std::string_view view() const noexcept { return std::string_view(m_plain); }
+};
 
 /**
 * compile time encrypted, run time decrypted string
+* ('Position' is the position of the string in the encrypted stream, so different strings use different keystreams)
 * do not use directly, use the more API friendly macros defined after this class
 **/
-template<class Logic, typename Index> class EncryptedString;
-template<class Logic, std::uint8_t...Ids> class EncryptedString<Logic, std::index_sequence<Ids...>> {
+template<class Logic, typename Index, std::uint64_t Position = 0> class EncryptedString;
+template<class Logic, std::size_t...Ids, std::uint64_t Position> class EncryptedString<Logic, std::index_sequence<Ids...>, Position> {
 	static_assert(std::is_class<Logic>::value, "EncryptedString<Logic,...> - Logic must be a struct with methods 'Encryption' & 'Decryption'.");
 	static_assert(has_Encryption_method<Logic>::value, "EncryptedString<Logic,...> - Logic must be a struct with method 'Encryption'.");
 	static_assert(has_Decryption_method<Logic>::value, "EncryptedString<Logic,...> - Logic must be a struct with method 'Decryption'.");
@@ -90,21 +497,217 @@ template<class Logic, std::uint8_t...Ids> class EncryptedString<Logic, std::inde
 
     // constructor ( string is encrypted during construction (compile time))
     public:
-        explicit constexpr EncryptedString(const char* str) : m_string{ Logic::Encryption(str[Ids], Ids) ... } {}
+        explicit constexpr EncryptedString(const char* str) : m_string{} {
+            EncryptedStringDetail::Encrypt<Logic>(str, m_string, sizeof...(Ids), Position);
+        }
 
     // decryption (during run time)
     public:
-        char* Decrypt() {
-            for (std::uint8_t i{}; i < sizeof...(Ids); ++i) {
-                m_string[i] = Logic::Decryption(m_string[i], i);
-            }
-            m_string[sizeof...(Ids)] = '\0';
-            return m_string;
+
+        // amount of characters (including the terminating null of the literal)
+        static constexpr std::size_t size() noexcept { return sizeof...(Ids); }
+
+        /**
+        * \brief decrypt into a caller provided buffer (encrypted object is left untouched, so concurrent calls are safe)
+        *
+        * @param {char*, out} buffer (at least 'size() + 1' characters long)
+        * @param {char*, out} buffer
+        **/
+        char* Decrypt(char* xo_buffer) const noexcept {
+            EncryptedStringDetail::Decrypt<Logic>(m_string, xo_buffer, sizeof...(Ids), Position);
+            xo_buffer[sizeof...(Ids)] = '\0';
+            return xo_buffer;
+        }
+
+        // decrypt into a scoped accessor (stack storage, wiped on scope exit)
+        ScopedDecryptedString<sizeof...(Ids)> Scoped() const noexcept {
+            return ScopedDecryptedString<sizeof...(Ids)>(m_string, Position, static_cast<Logic*>(nullptr));
+        }
+
+        // decrypt in place (string stays decrypted in memory, should be called once)
+        char* Decrypt() noexcept {
+            return Decrypt(m_string);
         }
 };
 
+// key seed of a translation unit (its compilation date and time)
+#define ENCRYPTED_STRING_SEED (EncryptedStringDetail::Fnv(__DATE__ " " __TIME__))
+
+// unique (per translation unit) position in the encrypted stream (strings are up to 4GB long)
+#define ENCRYPTED_STRING_POSITION ((static_cast<std::uint64_t>(__LINE__) << 48) ^ (static_cast<std::uint64_t>(__COUNTER__) << 32))
+
 // Compile-time string encryption macro
-#define EncryptString(str) (EncryptedString<EncryptionSchema, std::make_index_sequence<sizeof(str)>>(str))
+#define EncryptString(str) (EncryptedString<EncryptionSchema<ENCRYPTED_STRING_SEED>, std::make_index_sequence<sizeof(str)>, \
+                                           EncryptedStringDetail::LiteralPosition(ENCRYPTED_STRING_POSITION, sizeof(str))>(str))
 
 // Run-time string decryption macro
 #define DecryptObject(obj) (obj.Decrypt())
+
+/**
+* compile time encrypted table of strings - all strings are packed (null terminated) into a single encrypted blob
+* and are located using an offset index.
+* do not use directly, use the 'EncryptStringTable' macro defined after this class
+**/
+template<class Logic, std::size_t Size, std::size_t Count, std::uint64_t Position = 0> class EncryptedStringTable {
+	static_assert(has_Encryption_method<Logic>::value, "EncryptedStringTable<Logic,...> - Logic must be a struct with method 'Encryption'.");
+	static_assert(has_Decryption_method<Logic>::value, "EncryptedStringTable<Logic,...> - Logic must be a struct with method 'Decryption'.");
+
+    // properties
+    private:
+        std::array<char, Size>             m_blob;      // encrypted strings
+        std::array<std::size_t, Count + 1> m_offsets;   // string i is [m_offsets[i], m_offsets[i + 1] - 1) (excluding its null)
+
+    // constructor (strings are encrypted during construction (compile time))
+    public:
+        template<std::size_t ...Ns>
+        explicit constexpr EncryptedStringTable(const char(&...xi_strings)[Ns]) : m_blob{}, m_offsets{} {
+            std::size_t position{}, index{};
+            std::array<char, Size> plain{};
+            const auto add = [this, &plain, &position, &index](const char* xi_string, const std::size_t xi_length) {
+                m_offsets[index++] = position;
+                for (std::size_t i{}; i < xi_length; ++i) plain[position++] = xi_string[i];
+            };
+            (add(xi_strings, Ns), ...);
+            m_offsets[Count] = position;
+
+            // whole blob is encrypted at once, so each keystream block is generated once
+            EncryptedStringDetail::Encrypt<Logic>(plain.data(), m_blob.data(), Size, Position);
+        }
+
+    // API
+    public:
+        static constexpr std::size_t size() noexcept { return Count; }
+        static constexpr std::size_t bytes() noexcept { return Size; }
+        static constexpr std::uint64_t position() noexcept { return Position; }
+
+        constexpr const std::array<char, Size>& blob() const noexcept { return m_blob; }
+        constexpr const std::array<std::size_t, Count + 1>& offsets() const noexcept { return m_offsets; }
+};
+
+/**
+* \brief build a compile time encrypted string table
+*
+* @param {Logic,                in}  encryption schema
+* @param {Position,             in}  position of the table in the encrypted stream
+* @param {string literals,      in}  strings
+* @param {EncryptedStringTable, out} encrypted string table
+**/
+template<class Logic, std::uint64_t Position = 0, std::size_t ...Ns> constexpr EncryptedStringTable<Logic, (Ns + ... + 0), sizeof...(Ns), Position> MakeEncryptedStringTable(const char(&...xi_strings)[Ns]) {
+    return EncryptedStringTable<Logic, (Ns + ... + 0), sizeof...(Ns), Position>(xi_strings...);
+}
+
+/**
+* run time decrypted string table.
+* the whole blob is decrypted in a single pass into its own memory pages, which are then made read only
+* (and optionally locked in memory, so they are never swapped to disk). pages are wiped on destruction.
+**/
+class DecryptedStringTable {
+    // properties
+    private:
+        char*                          m_pages{ nullptr };
+        std::size_t                    m_capacity{};      // allocated bytes
+        std::unique_ptr<std::size_t[]> m_offsets;
+        std::size_t                    m_count{};
+        bool                           m_locked{ false };
+
+    // constructor
+    public:
+
+        /**
+        * \brief decrypt a string table
+        *
+        * @param {EncryptedStringTable, in} encrypted string table
+        * @param {bool,                 in} if true, decrypted pages are locked in memory
+        **/
+        template<class Logic, std::size_t Size, std::size_t Count, std::uint64_t Position>
+        explicit DecryptedStringTable(const EncryptedStringTable<Logic, Size, Count, Position>& xi_table, const bool xi_lock = false) : m_offsets(new std::size_t[Count + 1]), m_count(Count) {
+            for (std::size_t i{}; i <= Count; ++i) m_offsets[i] = xi_table.offsets()[i];
+
+            Allocate(Size);
+            EncryptedStringDetail::Decrypt<Logic>(xi_table.blob().data(), m_pages, Size, Position);
+            Protect(xi_lock);
+        }
+
+        ~DecryptedStringTable() { Release(); }
+
+        DecryptedStringTable(const DecryptedStringTable&)            = delete;
+        DecryptedStringTable& operator=(const DecryptedStringTable&) = delete;
+
+    // API
+    public:
+
+        // amount of strings
+        std::size_t size() const noexcept { return m_count; }
+
+        // are decrypted pages locked in memory
+        bool locked() const noexcept { return m_locked; }
+
+        // string at a given index
+        std::string_view operator[](const std::size_t i) const noexcept {
+            return std::string_view(m_pages + m_offsets[i], m_offsets[i + 1] - m_offsets[i] - 1);
+        }
+
+        // null terminated string at a given index
+        const char* c_str(const std::size_t i) const noexcept { return m_pages + m_offsets[i]; }
+
+    // internal helpers
+    private:
+
+        void Allocate(const std::size_t xi_size) {
+#if defined(ENCRYPTED_STRING_POSIX_PAGES)
+            const std::size_t page{ static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) };
+            m_capacity = ((xi_size + page - 1) / page) * page;
+            if (m_capacity == 0) m_capacity = page;
+            void* pages{ mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+            if (pages == MAP_FAILED) throw std::bad_alloc();
+            m_pages = static_cast<char*>(pages);
+#elif defined(ENCRYPTED_STRING_WINDOWS_PAGES)
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            const std::size_t page{ static_cast<std::size_t>(info.dwPageSize) };
+            m_capacity = ((xi_size + page - 1) / page) * page;
+            if (m_capacity == 0) m_capacity = page;
+            m_pages = static_cast<char*>(VirtualAlloc(nullptr, m_capacity, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+            if (m_pages == nullptr) throw std::bad_alloc();
+#else
+            m_capacity = (xi_size > 0) ? xi_size : 1;
+            m_pages = new char[m_capacity];
+#endif
+        }
+
+        void Protect(const bool xi_lock) noexcept {
+#if defined(ENCRYPTED_STRING_POSIX_PAGES)
+            if (xi_lock) m_locked = (mlock(m_pages, m_capacity) == 0);
+            mprotect(m_pages, m_capacity, PROT_READ);
+#elif defined(ENCRYPTED_STRING_WINDOWS_PAGES)
+            if (xi_lock) m_locked = (VirtualLock(m_pages, m_capacity) != 0);
+            DWORD previous;
+            VirtualProtect(m_pages, m_capacity, PAGE_READONLY, &previous);
+#else
+            (void)xi_lock;
+#endif
+        }
+
+        void Release() noexcept {
+            if (m_pages == nullptr) return;
+#if defined(ENCRYPTED_STRING_POSIX_PAGES)
+            mprotect(m_pages, m_capacity, PROT_READ | PROT_WRITE);
+            EncryptedStringDetail::SecureWipe(m_pages, m_capacity);
+            if (m_locked) munlock(m_pages, m_capacity);
+            munmap(m_pages, m_capacity);
+#elif defined(ENCRYPTED_STRING_WINDOWS_PAGES)
+            DWORD previous;
+            VirtualProtect(m_pages, m_capacity, PAGE_READWRITE, &previous);
+            EncryptedStringDetail::SecureWipe(m_pages, m_capacity);
+            if (m_locked) VirtualUnlock(m_pages, m_capacity);
+            VirtualFree(m_pages, 0, MEM_RELEASE);
+#else
+            EncryptedStringDetail::SecureWipe(m_pages, m_capacity);
+            delete[] m_pages;
+#endif
+            m_pages = nullptr;
+        }
+};
+
+// Compile-time string table encryption macro
+#define EncryptStringTable(...) (MakeEncryptedStringTable<EncryptionSchema<ENCRYPTED_STRING_SEED>, ENCRYPTED_STRING_POSITION>(__VA_ARGS__))
@@ -0,0 +1,233 @@
+/**
+* A fixed capacity, run time, bi-directional flat map (dictionary) for small amount of entries (8 - 64).
+* complements 'CompileTimeDictionary' for dictionaries whose entries are only known at run time.
+*
+* keys and values are stored as two separate (SoA) 16 byte aligned arrays.
+* a lookup is a linear scan over the key (or value) array, 16 bytes at a time, using a vector
+* compare followed by a move mask (requires SSE2, otherwise a scalar scan is performed).
+* up to 64 elements are scanned without a branch per block.
+* for 32bit keys it outperforms 'std::map' at all sizes, and 'std::unordered_map' up to ~32 entries.
+*
+* integral (and enumeration) keys/values of 1, 2, 4 or 8 bytes are searched using vector instructions,
+* other types are searched using a scalar scan.
+*
+* example usage:
+*
+*   FlatDictionary<std::uint16_t, std::int32_t, 32> ports{ { 80, 0 }, { 443, 1 }, { 8080, 2 } };
+*   ports.insert(22, 3);
+*
+*   if (auto id = ports.find(443)) std::cout << *id << "\n";     // 1
+*   if (auto port = ports.find_key(2)) std::cout << *port << "\n"; // 8080
+*
+*   ports.erase(80);
+*   std::cout << ports.size() << "\n";                            // 3
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include<algorithm>
+#include<array>
+#include<assert.h>
+#include<cstdint>
+#include<initializer_list>
+#include<optional>
+#include<type_traits>
+#include<utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FLAT_DICTIONARY_SIMD_SEARCH
+#include<immintrin.h>
+#endif
+
+namespace FlatDictionaryDetail {
+
+    // can elements of type T be searched using vector instructions
+    template<typename T> inline constexpr bool is_vector_searchable_v = (std::is_integral_v<T> || std::is_enum_v<T>) &&
+                                                                        ((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8));
+
+    // amount of elements of type T which occupy a whole number of 16 byte blocks (or 64 elements, if more then 64), and are not less then N
+    template<typename T, std::size_t N> constexpr std::size_t padded() noexcept {
+        if constexpr (!is_vector_searchable_v<T>) return N;
+        const std::size_t blocks{ ((N * sizeof(T) + 15) / 16) * 16 / sizeof(T) };
+        return (blocks <= 64) ? blocks : ((blocks + 63) / 64) * 64;
+    }
+
+    // index of lowest set bit (mask must not be zero)
+    inline unsigned lowest_bit(const std::uint64_t xi_mask) noexcept {
+        assert(xi_mask != 0);
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(xi_mask));
+#else
+        unsigned i{};
+        while (((xi_mask >> i) & 1u) == 0) ++i;
+        return i;
+#endif
+    }
+
+    /**
+    * \brief return the index of the first element (among the first 'xi_size' elements) equal to a given value
+    *
+    * @param {Capacity}    array length (see 'padded')
+    * @param {T*,     in}  16 byte aligned array
+    * @param {size_t, in}  amount of elements to search
+    * @param {T,      in}  value to search
+    * @param {size_t, out} index of value ('xi_size' if value does not exist)
+    **/
+    template<std::size_t Capacity, typename T> std::size_t find(const T* xi_data, const std::size_t xi_size, const T& xi_value) noexcept {
+#ifdef FLAT_DICTIONARY_SIMD_SEARCH
+        if constexpr (is_vector_searchable_v<T>) {
+            constexpr std::size_t Lanes{ 16 / sizeof(T) };
+
+            __m128i needle;
+            if constexpr (sizeof(T) == 1)      needle = _mm_set1_epi8(static_cast<char>(xi_value));
+            else if constexpr (sizeof(T) == 2) needle = _mm_set1_epi16(static_cast<short>(xi_value));
+            else if constexpr (sizeof(T) == 4) needle = _mm_set1_epi32(static_cast<int>(xi_value));
+            else                               needle = _mm_set1_epi64x(static_cast<long long>(xi_value));
+
+            // one bit per matching lane
+            auto lanes = [&needle](const T* xi_block) -> unsigned {
+                const __m128i block{ _mm_load_si128(reinterpret_cast<const __m128i*>(xi_block)) };
+                if constexpr (sizeof(T) == 1) {
+                    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+                }
+                else if constexpr (sizeof(T) == 2) {
+                    return static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(block, needle), _mm_setzero_si128())));
+                }
+                else if constexpr (sizeof(T) == 4) {
+                    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+                }
+                else {
+                    // 64 bit lanes are compared as two 32 bit lanes, both must match
+                    const __m128i equal{ _mm_cmpeq_epi32(block, needle) };
+                    return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(equal, _mm_shuffle_epi32(equal, 0xB1)))));
+                }
+            };
+
+            // scan 64 elements at a time without branching on intermediate blocks
+            // (blocks count is a compile time constant, so the inner loop is unrolled)
+            for (std::size_t first{}; first < xi_size; first += 64) {
+                constexpr std::size_t Count{ (Capacity < 64) ? Capacity : 64 };
+
+                std::uint64_t mask{};
+                for (std::size_t i{}; i < Count; i += Lanes) {
+                    mask |= static_cast<std::uint64_t>(lanes(xi_data + first + i)) << i;
+                }
+                if (xi_size - first < 64) mask &= (std::uint64_t{ 1 } << (xi_size - first)) - 1;
+
+                if (mask != 0) return first + lowest_bit(mask);
+            }
+
+            return xi_size;
+        }
+        else
+#endif
+        {
+            return static_cast<std::size_t>(std::find(xi_data, xi_data + xi_size, xi_value) - xi_data);
+        }
+    }
+}
+
+/**
+* \brief fixed capacity run time bi-directional flat dictionary
+*
+* @param {K} key type
+* @param {V} value type
+* @param {N} capacity (maximal amount of entries)
+**/
+template<typename K, typename V, std::size_t N> class FlatDictionary {
+    static_assert(N > 0, "FlatDictionary capacity must be positive.");
+
+    // properties
+    private:
+        static constexpr std::size_t KeysCapacity{ FlatDictionaryDetail::padded<K, N>() },
+                                     ValuesCapacity{ FlatDictionaryDetail::padded<V, N>() };
+
+        alignas(16) std::array<K, KeysCapacity>   m_keys{};
+        alignas(16) std::array<V, ValuesCapacity> m_values{};
+        std::size_t m_size{};
+
+    // constructor
+    public:
+        FlatDictionary() = default;
+
+        FlatDictionary(std::initializer_list<std::pair<K, V>> xi_entries) {
+            for (const auto& entry : xi_entries) insert(entry.first, entry.second);
+        }
+
+    // API
+    public:
+
+        // amount of entries
+        std::size_t size() const noexcept { return m_size; }
+
+        // maximal amount of entries
+        static constexpr std::size_t capacity() noexcept { return N; }
+
+        bool empty() const noexcept { return m_size == 0; }
+
+        void clear() noexcept { m_size = 0; }
+
+        /**
+        * \brief insert an entry
+        *
+        * @param {K,    in}  key
+        * @param {V,    in}  value
+        * @param {bool, out} true if entry was inserted, false if key already exists or dictionary is full
+        **/
+        bool insert(const K& xi_key, const V& xi_value) {
+            if ((m_size == N) || contains(xi_key)) return false;
+
+            m_keys[m_size]   = xi_key;
+            m_values[m_size] = xi_value;
+            ++m_size;
+            return true;
+        }
+
+        /**
+        * \brief remove an entry (entries order is not preserved)
+        *
+        * @param {K,    in}  key
+        * @param {bool, out} true if entry was removed, false if key does not exist
+        **/
+        bool erase(const K& xi_key) {
+            const std::size_t i{ FlatDictionaryDetail::find<KeysCapacity>(m_keys.data(), m_size, xi_key) };
+            if (i == m_size) return false;
+
+            --m_size;
+            m_keys[i]   = std::move(m_keys[m_size]);
+            m_values[i] = std::move(m_values[m_size]);
+            return true;
+        }
+
+        /**
+        * \brief given a key, return its value
+        *
+        * @param {K,        in}  key
+        * @param {optional, out} value (empty if key does not exist in dictionary)
+        **/
+        std::optional<V> find(const K& xi_key) const noexcept {
+            const std::size_t i{ FlatDictionaryDetail::find<KeysCapacity>(m_keys.data(), m_size, xi_key) };
+            return (i < m_size) ? std::optional<V>(m_values[i]) : std::nullopt;
+        }
+
+        /**
+        * \brief given a value, return its key (if several keys share the value - the first inserted one which was not moved by 'erase')
+        *
+        * @param {V,        in}  value
+        * @param {optional, out} key (empty if value does not exist in dictionary)
+        **/
+        std::optional<K> find_key(const V& xi_value) const noexcept {
+            const std::size_t i{ FlatDictionaryDetail::find<ValuesCapacity>(m_values.data(), m_size, xi_value) };
+            return (i < m_size) ? std::optional<K>(m_keys[i]) : std::nullopt;
+        }
+
+        // test if a given key exists in dictionary
+        bool contains(const K& xi_key) const noexcept { return FlatDictionaryDetail::find<KeysCapacity>(m_keys.data(), m_size, xi_key) < m_size; }
+
+        // test if a given value exists in dictionary
+        bool contains_value(const V& xi_value) const noexcept { return FlatDictionaryDetail::find<ValuesCapacity>(m_values.data(), m_size, xi_value) < m_size; }
+
+        // iterate over keys/values (SoA)
+        const K* keys()   const noexcept { return m_keys.data(); }
+        const V* values() const noexcept { return m_values.data(); }
+};
@@ -1,9 +1,91 @@
 /**
 * A generic visitor
 *
+* > Visitor/Visitable/VisitableImpl/GenericVisitor - an open set of visit-able types, visited through double dispatch
+*   (a virtual 'accept' followed by a virtual 'visit').
+* > VariantVisitable - a closed set of visit-able types (given as a 'DataStructure::type_list'), stored by value as a
+*   compact tagged union and visited through a switch (or a compile time generated function table) over its tag.
+*
+* example usage (double dispatch):
+*
+*   #include <iostream>
+*
+*   // an 'expression' interface
+*   class Expression {
+*   public:
+*       virtual std::string name() = 0;
+*   };
+*
+*   // forward deceleration of 'constant' and 'variable' objects
+*   template<typename T> class Constant;
+*   class Variable;
+*
+*   // 'constant' object
+*   template<typename T> class Constant : public Expression, public VisitableImpl<Constant<T>, Constant<T>, Variable> {
+*       public:
+*           virtual std::string name() { return "Constant"; }
+*   };
+*
+*   // 'variable' object
+*   class Variable : public Expression, public VisitableImpl<Variable, Constant<double>, Variable> {
+*       public:
+*           virtual std::string name() { return "Variable"; }
+*   };
+*
+*   // a visitor for 'constant' and 'variable' objects
+*   class ExpressionVisitor {
+*       public:
+*           ExpressionVisitor() { std::cout << "ExpressionVisitor was created.\n"; }
+*           template<typename T> void visit(Constant<T> c) { std::cout << "visited a 'Constant' object.\n"; }
+*           void visit(Variable c) { std::cout << "visited a 'Variable' object.\n"; }
+*   };
+*
+*   int main() {
+*       Variable var;
+*       Constant<double> con;
+*
+*       GenericVisitor<ExpressionVisitor, Constant<double>, Variable> v;
+*
+*       v.visit(var);
+*       v.visit(con);
+*
+*       return 0;
+*   }
+*
+* example usage (closed set):
+*
+*   struct Constant { double value; };
+*   struct Variable { std::size_t slot; };
+*   struct Negate   { std::uint32_t operand; };
+*
+*   using Node = VariantVisitable<DataStructure::type_list<Constant, Variable, Negate>>;
+*   std::vector<Node> nodes{ Constant{ 2.0 }, Variable{ 0 }, Negate{ 1 } };
+*
+*   struct Printer {
+*       void visit(const Constant& c) { std::cout << c.value << "\n"; }
+*       void visit(const Variable& v) { std::cout << 'x' << v.slot << "\n"; }
+*       void visit(const Negate& n)   { std::cout << "-[" << n.operand << "]\n"; }
+*   } printer;
+*   for (const Node& node : nodes) node.accept(printer);
+*
+*   double sum{};
+*   for (const Node& node : nodes) sum += node.visit([](const auto& n) -> double { ... });
+*
 * Dan Israel Malta
 **/
+#pragma once
+#include "TypeList.h"
+#include <algorithm>
+#include <array>
+#include <assert.h>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 // forward deceleration of a variadic visitor interface
 template<typename ... Types> class Visitor;
@@ -11,6 +93,7 @@ template<typename ... Types> class Visitor;
 // one argument visitor interface
 template<typename T> class Visitor<T> {
 	public:
+		virtual ~Visitor() = default;
 		virtual void visit(T& visitable) = 0;
 };
 
@@ -24,6 +107,7 @@ template<typename T, typename ... TList> class Visitor<T, TList ...> : public Vi
 // variadic visit-able interface 
 template<typename ... TList> class Visitable {
 	public:
+		virtual ~Visitable() = default;
 		virtual void accept(Visitor<TList ...> & visitor) = 0;
 };
 
@@ -79,54 +163,412 @@ public:
 	}
 };
 
-// ---------------------
-// --- example usage ---
-// ---------------------
+namespace GenericVisitorDetail {
 
-#include "GenericVisitor.h"
-#include <iostream>
+	// smallest unsigned integral which can hold N different tags
+	template<std::size_t N> using tag_t = std::conditional_t<(N <= 0xFF), std::uint8_t, std::conditional_t<(N <= 0xFFFF), std::uint16_t, std::uint32_t>>;
 
-// an 'expression' interface
-class Expression {
-public:
-	virtual std::string name() = 0;
-};
+	// first index of type T in a parameter pack
+	template<typename T, typename... Ts> constexpr std::size_t index_of() noexcept {
+		constexpr bool match[]{ std::is_same_v<T, Ts>... };
+		std::size_t i{};
+		while (!match[i]) ++i;
+		return i;
+	}
+
+	// test if all types in parameter pack are unique
+	template<typename... Ts> constexpr bool are_unique() noexcept {
+		constexpr std::size_t indices[]{ index_of<Ts, Ts...>()... };
+		for (std::size_t i{}; i < sizeof...(Ts); ++i) {
+			if (indices[i] != i) return false;
+		}
+		return true;
+	}
+
+	// maximal amount of types which are dispatched through a switch
+	inline constexpr std::size_t SwitchCases{ 16 };
+
+	// a type as a value
+	template<typename T> struct type_tag { using type = T; };
+
+	// function table entry
+	template<typename Function, typename T> decltype(auto) invoke(Function& xi_function) {
+		return xi_function(type_tag<T>{});
+	}
+
+	/**
+	* \brief call 'xi_function(type_tag<T>{})', where T is the 'xi_index' type in a type list.
+	*        dispatch is a switch (up to 16 types, so calls can be inlined) or an indirect call through a compile time
+	*        generated function table.
+	*
+	* @param {size_t,   in}  type index (must be smaller then amount of types)
+	* @param {Function, in}  function object
+	* @param {R,        out} function return value (must be identical for all types)
+	**/
+	template<typename ... Ts, typename Function> decltype(auto) dispatch(const std::size_t xi_index, Function&& xi_function) {
+		using Result = decltype(xi_function(type_tag<Pack::element_at_index<0, Ts...>>{}));
 
-// forward deceleration of 'constant' and 'variable' objects
-template<typename T> class Constant;
-class Variable;
+		if constexpr (sizeof...(Ts) <= SwitchCases) {
+#define M_GENERIC_VISITOR_CASE(I)                                                                          \
+			case I:                                                                                        \
+				if constexpr (I < sizeof...(Ts)) {                                                         \
+					return static_cast<Result>(xi_function(type_tag<Pack::element_at_index<I, Ts...>>{})); \
+				}                                                                                          \
+				[[fallthrough]];
 
-// 'constant' object
-template<typename T> class Constant : public Expression, public VisitableImpl<Constant<T>, Constant<T>, Variable> {
+			switch (xi_index) {
+				M_GENERIC_VISITOR_CASE(0)  M_GENERIC_VISITOR_CASE(1)  M_GENERIC_VISITOR_CASE(2)  M_GENERIC_VISITOR_CASE(3)
+				M_GENERIC_VISITOR_CASE(4)  M_GENERIC_VISITOR_CASE(5)  M_GENERIC_VISITOR_CASE(6)  M_GENERIC_VISITOR_CASE(7)
+				M_GENERIC_VISITOR_CASE(8)  M_GENERIC_VISITOR_CASE(9)  M_GENERIC_VISITOR_CASE(10) M_GENERIC_VISITOR_CASE(11)
+				M_GENERIC_VISITOR_CASE(12) M_GENERIC_VISITOR_CASE(13) M_GENERIC_VISITOR_CASE(14) M_GENERIC_VISITOR_CASE(15)
+				default: break;
+			}
+#undef M_GENERIC_VISITOR_CASE
+
+			// index is always valid
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_unreachable();
+#elif defined(_MSC_VER)
+			__assume(0);
+#endif
+		}
+		else {
+			using Callable = std::remove_reference_t<Function>;
+			using Entry    = Result (*)(Callable&);
+			static constexpr Entry table[]{ &invoke<Callable, Ts>... };
+			return table[xi_index](xi_function);
+		}
+	}
+}
+
+// forward deceleration of a closed set visit-able object
+template<typename TList> class VariantVisitable;
+
+/**
+* \brief closed set visit-able object - holds (by value) one object whose type is one of a given list of types.
+*        a visit is a switch over the object type tag (so visit functions can be inlined) or, if there are more then
+*        16 types, an indirect call through a compile time generated function table.
+*        either way, there are no virtual calls and objects can be stored contiguously.
+*
+* @param {type_list, in} list of (unique, no throw move constructible) visit-able objects
+**/
+template<typename... Ts> class VariantVisitable<DataStructure::type_list<Ts...>> {
+	static_assert(sizeof...(Ts) > 0, "VariantVisitable: type list must not be empty.");
+	static_assert(GenericVisitorDetail::are_unique<Ts...>(), "VariantVisitable: types must be unique.");
+	static_assert((std::is_nothrow_move_constructible_v<Ts> && ...), "VariantVisitable: types must be no throw move constructible.");
+
+	// aliases
 	public:
-		virtual std::string name() { return "Constant"; }
-};
+		using types = DataStructure::type_list<Ts...>;
+		using Tag   = GenericVisitorDetail::tag_t<sizeof...(Ts)>;
+
+	// properties
+	private:
+		static constexpr bool TriviallyCopyable{ (std::is_trivially_copyable_v<Ts> && ...) },
+		                      TriviallyDestructible{ (std::is_trivially_destructible_v<Ts> && ...) };
+
+		alignas(Ts...) unsigned char m_storage[std::max({ sizeof(Ts)... })];
+		Tag m_tag;
 
-// 'variable' object
-class Variable : public Expression, public VisitableImpl<Variable, Constant<double>, Variable> {
+	// constructors
 	public:
-		virtual std::string name() { return "Variable"; }
-};
 
-// a visitor for 'constant' and 'variable' objects
-class ExpressionVisitor {
+		// construct from an object of one of the visit-able types
+		template<typename T, typename U = std::decay_t<T>, typename std::enable_if<Pack::is_type_in_pack<U, Ts...>>::type* = nullptr>
+		VariantVisitable(T&& xi_object) : m_tag(static_cast<Tag>(index_of<U>())) {
+			::new (static_cast<void*>(m_storage)) U(std::forward<T>(xi_object));
+		}
+
+		VariantVisitable(const VariantVisitable& xi_other) : m_tag(xi_other.m_tag) {
+			if constexpr (TriviallyCopyable) std::memcpy(m_storage, xi_other.m_storage, sizeof(m_storage));
+			else xi_other.visit([this](const auto& xi_object) { ::new (static_cast<void*>(m_storage)) std::decay_t<decltype(xi_object)>(xi_object); });
+		}
+
+		VariantVisitable(VariantVisitable&& xi_other) noexcept : m_tag(xi_other.m_tag) {
+			MoveFrom(xi_other);
+		}
+
+		VariantVisitable& operator=(const VariantVisitable& xi_other) {
+			if (this != &xi_other) {
+				VariantVisitable copy(xi_other);
+				Destroy();
+				m_tag = copy.m_tag;
+				MoveFrom(copy);
+			}
+			return *this;
+		}
+
+		VariantVisitable& operator=(VariantVisitable&& xi_other) noexcept {
+			if (this != &xi_other) {
+				Destroy();
+				m_tag = xi_other.m_tag;
+				MoveFrom(xi_other);
+			}
+			return *this;
+		}
+
+		~VariantVisitable() { Destroy(); }
+
+	// API
 	public:
-		ExpressionVisitor() { std::cout << "ExpressionVisitor was created.\n"; }
-		template<typename T> void visit(Constant<T> c) { std::cout << "visited a 'Constant' object.\n"; }
-		void visit(Variable c) { std::cout << "visited a 'Variable' object.\n"; }
+
+		// index (in type list) of a given type
+		template<typename T> static constexpr std::size_t index_of() noexcept {
+			static_assert(Pack::is_type_in_pack<T, Ts...>, "VariantVisitable: type is not in type list.");
+			return GenericVisitorDetail::index_of<T, Ts...>();
+		}
+
+		// index (in type list) of held object type
+		std::size_t index() const noexcept { return m_tag; }
+
+		// test if held object is of a given type
+		template<typename T> bool holds() const noexcept { return m_tag == index_of<T>(); }
+
+		// access held object (its type must be T)
+		template<typename T> T& get() noexcept {
+			assert(holds<T>());
+			return *std::launder(reinterpret_cast<T*>(m_storage));
+		}
+		template<typename T> const T& get() const noexcept {
+			assert(holds<T>());
+			return *std::launder(reinterpret_cast<const T*>(m_storage));
+		}
+
+		/**
+		* \brief call 'xi_visitor.visit(object)' on held object (visitor follows 'GenericVisitor' protocol, i.e. - overloads 'visit')
+		*
+		* @param {Visitor, in}  visitor object
+		* @param {R,       out} visit return value (must be identical for all types)
+		**/
+		template<typename Visitor> decltype(auto) accept(Visitor&& xi_visitor)       { return Dispatch(*this, [&xi_visitor](auto& xi_object) -> decltype(auto) { return xi_visitor.visit(xi_object); }); }
+		template<typename Visitor> decltype(auto) accept(Visitor&& xi_visitor) const { return Dispatch(*this, [&xi_visitor](auto& xi_object) -> decltype(auto) { return xi_visitor.visit(xi_object); }); }
+
+		/**
+		* \brief call 'xi_function(object)' on held object
+		*
+		* @param {Function, in}  function object (i.e. - a generic lambda)
+		* @param {R,        out} function return value (must be identical for all types)
+		**/
+		template<typename Function> decltype(auto) visit(Function&& xi_function)       { return Dispatch(*this, xi_function); }
+		template<typename Function> decltype(auto) visit(Function&& xi_function) const { return Dispatch(*this, xi_function); }
+
+	// internal helpers
+	private:
+
+		// call 'xi_function' with held object of (possibly const) 'xi_self'
+		template<typename Self, typename Function> static decltype(auto) Dispatch(Self& xi_self, Function&& xi_function) {
+			return GenericVisitorDetail::dispatch<Ts...>(xi_self.m_tag, [&xi_self, &xi_function](auto xi_type) -> decltype(auto) {
+				using T = std::conditional_t<std::is_const_v<Self>, const typename decltype(xi_type)::type, typename decltype(xi_type)::type>;
+				return xi_function(*std::launder(reinterpret_cast<T*>(xi_self.m_storage)));
+			});
+		}
+
+		// move held object of 'xi_other' (whose tag was already copied) into storage
+		void MoveFrom(VariantVisitable& xi_other) noexcept {
+			if constexpr (TriviallyCopyable) std::memcpy(m_storage, xi_other.m_storage, sizeof(m_storage));
+			else xi_other.visit([this](auto& xi_object) { ::new (static_cast<void*>(m_storage)) std::decay_t<decltype(xi_object)>(std::move(xi_object)); });
+		}
+
+		// destroy held object
+		void Destroy() noexcept {
+			if constexpr (!TriviallyDestructible) {
+				visit([](auto& xi_object) {
+					using T = std::decay_t<decltype(xi_object)>;
+					xi_object.~T();
+				});
+			}
+		}
 };
 
+namespace GenericVisitorDetail {
+
+	/**
+	* \brief sort pointers by address (LSD radix sort over the address span, 11 bits per pass)
+	*
+	* @param {vector, in|out} pointers
+	* @param {vector, in}     scratch buffer
+	**/
+	template<typename T> void sort_by_address(std::vector<T*>& xio_pointers, std::vector<std::uintptr_t>& xi_scratch) {
+		constexpr std::size_t Bits{ 11 },
+		                      Radix{ std::size_t{ 1 } << Bits };
+		if (std::is_sorted(xio_pointers.begin(), xio_pointers.end(), std::less<T*>())) return;
+
+		// keys are offsets from lowest address
+		std::uintptr_t low{ reinterpret_cast<std::uintptr_t>(xio_pointers[0]) },
+		               high{ low };
+		for (T* pointer : xio_pointers) {
+			low  = std::min(low,  reinterpret_cast<std::uintptr_t>(pointer));
+			high = std::max(high, reinterpret_cast<std::uintptr_t>(pointer));
+		}
+		std::size_t passes{};
+		for (std::uintptr_t span{ (high - low) / alignof(T) }; span > 0; span >>= Bits) ++passes;
 
-int main(int argc, char * argv[]) {
+		std::vector<std::uintptr_t> keys(xio_pointers.size());
+		for (std::size_t i{}; i < keys.size(); ++i) keys[i] = (reinterpret_cast<std::uintptr_t>(xio_pointers[i]) - low) / alignof(T);
+		xi_scratch.resize(keys.size());
 
-	Variable var;
-	Constant<double> con;
+		for (std::size_t pass{}; pass < passes; ++pass) {
+			const std::size_t shift{ pass * Bits };
+			std::size_t count[Radix + 1]{};
+			for (const std::uintptr_t key : keys) ++count[((key >> shift) & (Radix - 1)) + 1];
+			for (std::size_t r{}; r < Radix; ++r) count[r + 1] += count[r];
+			for (const std::uintptr_t key : keys) xi_scratch[count[(key >> shift) & (Radix - 1)]++] = key;
+			keys.swap(xi_scratch);
+		}
+
+		for (std::size_t i{}; i < keys.size(); ++i) xio_pointers[i] = reinterpret_cast<T*>(low + keys[i] * alignof(T));
+	}
 
-	GenericVisitor<ExpressionVisitor, Constant<double>, Variable> v;
+	// implementation of 'Visitor<Ts...>' which forwards every 'visit' to a function object
+	template<typename Interface, typename Function, typename ... TList> class ForwardingVisitor;
 
-	v.visit(var);
-	v.visit(con);
+	template<typename Interface, typename Function> class ForwardingVisitor<Interface, Function> : public Interface {
+		protected:
+			Function& function;
 
-	return 0;
+		public:
+			explicit ForwardingVisitor(Function& xi_function) : function(xi_function) {}
+	};
 
+	template<typename Interface, typename Function, typename T, typename ... TList> class ForwardingVisitor<Interface, Function, T, TList ...> : public ForwardingVisitor<Interface, Function, TList ...> {
+		public:
+			using ForwardingVisitor<Interface, Function, TList ...>::ForwardingVisitor;
+
+			void visit(T& t) override {
+				this->function(t);
+			}
+	};
 }
+
+// order of nodes inside 'BatchVisitor' buckets
+enum class BatchOrder { Grouped,    // by node address
+                        Preserve }; // by collection order (original position of each node is recorded)
+
+/**
+* \brief visit a heterogeneous collection of nodes type by type.
+*        nodes are grouped (once) by their dynamic type into per type buckets, which are then visited (as many times
+*        as required) by one monomorphic loop per type, so the visit of a given type is a direct (inline-able) call and
+*        its branches and code stay hot for the whole bucket.
+*
+*        > grouped mode (default) - each bucket is ordered by node address, so heap allocated nodes are walked in memory order.
+*        > order preserving mode  - each bucket keeps collection order, and 'accept_indexed' passes the visitor each node
+*                                   original position ('visit(T&, std::size_t)'), i.e. - to write results in collection order.
+*
+*        example usage:
+*
+*        std::vector<std::unique_ptr<Visitable<Constant, Variable, Add>>> tree{ ... };
+*        BatchVisitor<Constant, Variable, Add> batch(tree.begin(), tree.end());
+*        batch.accept(evaluator);                       // evaluator.visit(Constant&), visit(Variable&), visit(Add&)
+*
+*        BatchVisitor<Constant, Variable, Add> ordered(tree.begin(), tree.end(), BatchOrder::Preserve);
+*        ordered.accept_indexed(writer);                // writer.visit(Constant&, std::size_t), ...
+*
+* @param {..., in} list of visit-able objects
+**/
+template<typename ... TList> class BatchVisitor {
+	static_assert(sizeof...(TList) > 0, "BatchVisitor: type list must not be empty.");
+	static_assert(GenericVisitorDetail::are_unique<TList...>(), "BatchVisitor: types must be unique.");
+
+	// properties
+	private:
+		std::tuple<std::vector<TList*> ...>                    m_buckets;
+		std::array<std::vector<std::size_t>, sizeof...(TList)> m_positions;    // original position of each bucket node (order preserving mode only)
+		BatchOrder m_order;
+
+	// constructor
+	public:
+		explicit BatchVisitor(const BatchOrder xi_order = BatchOrder::Grouped) : m_order(xi_order) {}
+
+		/**
+		* \brief group a collection of nodes
+		*
+		* @param {iterator,   in} collection first node
+		* @param {iterator,   in} collection last node
+		* @param {BatchOrder, in} bucket order (default is grouped)
+		**/
+		template<class It> BatchVisitor(It xi_first, It xi_last, const BatchOrder xi_order = BatchOrder::Grouped) : m_order(xi_order) {
+			assign(xi_first, xi_last);
+		}
+
+	// API
+	public:
+
+		/**
+		* \brief replace grouped nodes with a new collection.
+		*        a node is either a (smart) pointer to 'Visitable<TList...>' (its type is found through one 'accept' call),
+		*        or a 'VariantVisitable<DataStructure::type_list<TList...>>' (its type is found from its tag).
+		*        nodes are referenced (not copied) and are visited through mutable references, so they must outlive
+		*        the visitor and the collection must not be const (a const 'VariantVisitable' collection is rejected).
+		*
+		* @param {iterator, in} collection first node
+		* @param {iterator, in} collection last node
+		**/
+		template<class It> void assign(It xi_first, It xi_last) {
+			clear();
+
+			std::size_t position{};
+			const auto insert = [this, &position](auto& xi_node) {
+				using T = std::decay_t<decltype(xi_node)>;
+				std::get<std::vector<T*>>(m_buckets).push_back(&xi_node);
+				if (m_order == BatchOrder::Preserve) m_positions[GenericVisitorDetail::index_of<T, TList...>()].push_back(position);
+			};
+
+			using Node = std::decay_t<decltype(*xi_first)>;
+			if constexpr (std::is_same_v<Node, VariantVisitable<DataStructure::type_list<TList ...>>>) {
+				static_assert(!std::is_const_v<std::remove_reference_t<decltype(*xi_first)>>, "BatchVisitor: nodes are visited through mutable references, collection must not be const.");
+				for (; xi_first != xi_last; ++xi_first, ++position) (*xi_first).visit(insert);
+			}
+			else {
+				static_assert(!std::is_const_v<std::remove_reference_t<decltype(**xi_first)>>, "BatchVisitor: nodes are visited through mutable references, nodes must not be const.");
+				GenericVisitorDetail::ForwardingVisitor<Visitor<TList ...>, decltype(insert), TList ...> classifier(insert);
+				for (; xi_first != xi_last; ++xi_first, ++position) (**xi_first).accept(classifier);
+			}
+
+			if (m_order == BatchOrder::Grouped) {
+				std::vector<std::uintptr_t> scratch;
+				(GenericVisitorDetail::sort_by_address(std::get<std::vector<TList*>>(m_buckets), scratch), ...);
+			}
+		}
+
+		// remove all nodes
+		void clear() noexcept {
+			(std::get<std::vector<TList*>>(m_buckets).clear(), ...);
+			for (std::vector<std::size_t>& positions : m_positions) positions.clear();
+		}
+
+		// amount of grouped nodes
+		std::size_t size() const noexcept { return (std::get<std::vector<TList*>>(m_buckets).size() + ...); }
+
+		bool empty() const noexcept { return size() == 0; }
+
+		// nodes of a given type
+		template<typename T> const std::vector<T*>& bucket() const noexcept { return std::get<std::vector<T*>>(m_buckets); }
+
+		// original position of nodes of a given type (order preserving mode)
+		template<typename T> const std::vector<std::size_t>& positions() const noexcept { return m_positions[GenericVisitorDetail::index_of<T, TList...>()]; }
+
+		/**
+		* \brief visit all nodes, type by type (in type list order), with one monomorphic loop per type
+		*
+		* @param {Visitor, in} visitor object (follows 'GenericVisitor' protocol, i.e. - overloads 'visit(T&)')
+		**/
+		template<typename Visitor> void accept(Visitor&& xi_visitor) const {
+			([this, &xi_visitor]() {
+				for (TList* node : std::get<std::vector<TList*>>(m_buckets)) xi_visitor.visit(*node);
+			}(), ...);
+		}
+
+		/**
+		* \brief visit all nodes, type by type (in type list order), along with their original position (order preserving mode)
+		*
+		* @param {Visitor, in} visitor object (overloads 'visit(T&, std::size_t)')
+		**/
+		template<typename Visitor> void accept_indexed(Visitor&& xi_visitor) const {
+			assert(m_order == BatchOrder::Preserve);
+			([this, &xi_visitor]() {
+				const std::vector<TList*>& bucket{ std::get<std::vector<TList*>>(m_buckets) };
+				const std::vector<std::size_t>& position{ positions<TList>() };
+				for (std::size_t i{}; i < bucket.size(); ++i) xi_visitor.visit(*bucket[i], position[i]);
+			}(), ...);
+		}
+};
@@ -0,0 +1,696 @@
+/**
+* A table driven lexer (tokenizer) generator.
+*
+* A set of token rules (each defined by a regular expression pattern) is compiled, during construction,
+* into a byte-class table and a deterministic finite state machine (same state/trigger semantics as 'FSM',
+* but the triggers are byte classes and all transitions are stored in a flat table).
+* Tokenization is performed using "longest match" semantics (ties are resolved in favour of the first rule).
+* States which loop on themselves (i.e. - identifiers, numbers, white spaces) consume their run
+* 16 bytes at a time (requires SSSE3, otherwise a byte by byte scan is performed).
+*
+* supported pattern syntax:
+* > literal characters
+* > '.' - any byte except '\n'
+* > '[...]', '[^...]' - character class (ranges are allowed, i.e. - [a-zA-Z_])
+* > '\d', '\w', '\s' - digits, word characters, white spaces
+* > '\n', '\t', '\r', '\f', '\v', '\0' and any escaped special character (i.e. - '\.', '\[', '\\')
+* > '(...)' grouping, '|' alternation, '*', '+', '?' repetition
+*
+* example usage:
+*
+*   enum Tokens : std::size_t { Identifier, Number, Space, Operator };
+*
+*   const Lexer lexer{ { Identifier, "[a-zA-Z_]\\w*"             },
+*                      { Number,     "\\d+(\\.\\d+)?"            },
+*                      { Space,      "\\s+",               true  },    // white spaces are consumed but not emitted
+*                      { Operator,   "==|=|\\+|-|\\*|/"          } };
+*
+*   const std::string source{ "speed = distance / 3.5" };
+*   for (const auto& token : tokenize(source, lexer)) {
+*       std::cout << token.m_id << " : " << token.m_text << "\n";    // 0 : speed, 3 : =, 0 : distance, 3 : /, 1 : 3.5
+*   }
+*
+*   // tokens text as a vector of string_view's (same as 'SplitView::to_vector_sv')
+*   std::vector<std::string_view> words{ tokenize(source, lexer).to_vector_sv() };
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include<algorithm>
+#include<assert.h>
+#include<bitset>
+#include<cstdint>
+#include<initializer_list>
+#include<iterator>
+#include<map>
+#include<stdexcept>
+#include<string>
+#include<string_view>
+#include<vector>
+
+#if defined(__SSSE3__) || defined(_MSC_VER)
+#define LEXER_SIMD_SCAN
+#include<immintrin.h>
+#endif
+
+/**
+* \brief a lexer (tokenizer) compiled from a set of token rules
+**/
+class Lexer {
+    // aliases
+    using state_type = std::uint32_t;
+    using byte_set   = std::bitset<256>;
+
+    // constants
+    static constexpr state_type  Dead{ 0 };                                      // DFA 'dead' state
+    static constexpr state_type  Start{ 1 };                                     // DFA initial state
+    static constexpr std::size_t NoRule{ static_cast<std::size_t>(-1) };         // DFA state which does not accept a rule
+
+    // public structures
+    public:
+
+        // token id given to a byte which does not start any rule
+        static constexpr std::size_t Invalid{ static_cast<std::size_t>(-1) };
+
+        // a token rule
+        struct Rule {
+            std::size_t      m_id;        // id of tokens generated by this rule
+            std::string_view m_pattern;   // rule pattern
+            bool             m_skip{};    // if true, matched tokens are consumed but not emitted
+        };
+
+        // a token
+        struct Token {
+            std::size_t      m_id;        // id of the rule which generated the token (or 'Invalid')
+            std::string_view m_text;      // token text (a view into the tokenized buffer)
+        };
+
+    // internal structures
+    private:
+
+        // NFA state (thompson construction), used only during compilation
+        struct NfaState {
+            byte_set         m_set;           // bytes on which this state moves to 'm_next'
+            int              m_next{ -1 };    // destination state for bytes in 'm_set'
+            std::vector<int> m_epsilon;       // epsilon transitions
+            std::size_t      m_rule{ NoRule };// index of rule accepted at this state
+        };
+
+        // NFA fragment
+        struct Fragment {
+            int m_start,
+                m_end;
+        };
+
+        // recursive descent pattern parser (builds NFA fragments)
+        class Parser {
+            // properties
+            private:
+                std::string_view       m_pattern;
+                std::size_t            m_position;
+                std::vector<NfaState>& m_nfa;
+
+            // API
+            public:
+                explicit Parser(std::string_view xi_pattern, std::vector<NfaState>& xio_nfa) : m_pattern(xi_pattern), m_position(0), m_nfa(xio_nfa) {}
+
+                Fragment Parse() {
+                    if (m_pattern.empty()) throw std::invalid_argument("Lexer: empty pattern.");
+                    const Fragment fragment{ Alternation() };
+                    if (m_position != m_pattern.size()) throw std::invalid_argument("Lexer: unbalanced ')' in pattern.");
+                    return fragment;
+                }
+
+            // internal helpers
+            private:
+                int NewState() {
+                    m_nfa.emplace_back();
+                    return static_cast<int>(m_nfa.size() - 1);
+                }
+
+                bool AtEnd() const noexcept { return m_position >= m_pattern.size(); }
+                char Peek()  const noexcept { return m_pattern[m_position]; }
+
+                Fragment Epsilon() {
+                    const int s{ NewState() };
+                    return { s, s };
+                }
+
+                Fragment Set(const byte_set& xi_set) {
+                    const int s{ NewState() },
+                              e{ NewState() };
+                    m_nfa[s].m_set  = xi_set;
+                    m_nfa[s].m_next = e;
+                    return { s, e };
+                }
+
+                // alternation := concatenation ('|' concatenation)*
+                Fragment Alternation() {
+                    Fragment left{ Concatenation() };
+                    while (!AtEnd() && (Peek() == '|')) {
+                        ++m_position;
+                        const Fragment right{ Concatenation() };
+                        const int s{ NewState() },
+                                  e{ NewState() };
+                        m_nfa[s].m_epsilon = { left.m_start, right.m_start };
+                        m_nfa[left.m_end].m_epsilon.push_back(e);
+                        m_nfa[right.m_end].m_epsilon.push_back(e);
+                        left = { s, e };
+                    }
+                    return left;
+                }
+
+                // concatenation := repetition*
+                Fragment Concatenation() {
+                    if (AtEnd() || (Peek() == '|') || (Peek() == ')')) return Epsilon();
+
+                    Fragment fragment{ Repetition() };
+                    while (!AtEnd() && (Peek() != '|') && (Peek() != ')')) {
+                        const Fragment next{ Repetition() };
+                        m_nfa[fragment.m_end].m_epsilon.push_back(next.m_start);
+                        fragment.m_end = next.m_end;
+                    }
+                    return fragment;
+                }
+
+                // repetition := atom ('*' | '+' | '?')*
+                Fragment Repetition() {
+                    Fragment fragment{ Atom() };
+                    while (!AtEnd() && ((Peek() == '*') || (Peek() == '+') || (Peek() == '?'))) {
+                        const char op{ m_pattern[m_position++] };
+                        const int s{ NewState() },
+                                  e{ NewState() };
+                        m_nfa[s].m_epsilon.push_back(fragment.m_start);
+                        m_nfa[fragment.m_end].m_epsilon.push_back(e);
+                        if (op != '+') m_nfa[s].m_epsilon.push_back(e);
+                        if (op != '?') m_nfa[fragment.m_end].m_epsilon.push_back(fragment.m_start);
+                        fragment = { s, e };
+                    }
+                    return fragment;
+                }
+
+                // atom := '(' alternation ')' | '[' class ']' | '.' | escape | literal
+                Fragment Atom() {
+                    const char c{ m_pattern[m_position++] };
+                    switch (c) {
+                        case '(': {
+                            const Fragment fragment{ Alternation() };
+                            if (AtEnd() || (Peek() != ')')) throw std::invalid_argument("Lexer: unbalanced '(' in pattern.");
+                            ++m_position;
+                            return fragment;
+                        }
+                        case '[':
+                            return Set(Class());
+                        case '.': {
+                            byte_set set;
+                            set.set();
+                            set.reset('\n');
+                            return Set(set);
+                        }
+                        case '\\':
+                            return Set(Escape());
+                        case '*': case '+': case '?':
+                            throw std::invalid_argument("Lexer: repetition operator without an operand.");
+                        default: {
+                            byte_set set;
+                            set.set(static_cast<unsigned char>(c));
+                            return Set(set);
+                        }
+                    }
+                }
+
+                // escaped character (or predefined class)
+                byte_set Escape() {
+                    if (AtEnd()) throw std::invalid_argument("Lexer: pattern ends with an escape character.");
+
+                    byte_set set;
+                    const char c{ m_pattern[m_position++] };
+                    switch (c) {
+                        case 'd': for (int i{ '0' }; i <= '9'; ++i) set.set(i); break;
+                        case 'w': for (int i{ '0' }; i <= '9'; ++i) set.set(i);
+                                  for (int i{ 'a' }; i <= 'z'; ++i) set.set(i);
+                                  for (int i{ 'A' }; i <= 'Z'; ++i) set.set(i);
+                                  set.set('_');
+                                  break;
+                        case 's': for (const char w : { ' ', '\t', '\n', '\r', '\f', '\v' }) set.set(static_cast<unsigned char>(w)); break;
+                        case 'n': set.set('\n'); break;
+                        case 't': set.set('\t'); break;
+                        case 'r': set.set('\r'); break;
+                        case 'f': set.set('\f'); break;
+                        case 'v': set.set('\v'); break;
+                        case '0': set.set(0);    break;
+                        default:  set.set(static_cast<unsigned char>(c)); break;
+                    }
+                    return set;
+                }
+
+                // character class (opening '[' was already consumed)
+                byte_set Class() {
+                    byte_set set;
+                    bool negate{ false };
+                    if (!AtEnd() && (Peek() == '^')) {
+                        negate = true;
+                        ++m_position;
+                    }
+
+                    bool first{ true };
+                    while (!AtEnd() && ((Peek() != ']') || first)) {
+                        first = false;
+
+                        // escapes inside a class
+                        if (Peek() == '\\') {
+                            ++m_position;
+                            const byte_set escaped{ Escape() };
+                            if ((escaped.count() == 1) && !AtEnd() && (Peek() == '-') && (m_position + 1 < m_pattern.size()) && (m_pattern[m_position + 1] != ']')) {
+                                std::size_t low{};
+                                while (!escaped.test(low)) ++low;
+                                ++m_position;
+                                AddRange(set, low, RangeEnd());
+                            }
+                            else {
+                                set |= escaped;
+                            }
+                            continue;
+                        }
+
+                        // single character or a range
+                        const unsigned char low{ static_cast<unsigned char>(m_pattern[m_position++]) };
+                        if (!AtEnd() && (Peek() == '-') && (m_position + 1 < m_pattern.size()) && (m_pattern[m_position + 1] != ']')) {
+                            ++m_position;
+                            AddRange(set, low, RangeEnd());
+                        }
+                        else {
+                            set.set(low);
+                        }
+                    }
+
+                    if (AtEnd()) throw std::invalid_argument("Lexer: unbalanced '[' in pattern.");
+                    ++m_position;
+
+                    if (negate) set.flip();
+                    return set;
+                }
+
+                // upper bound of a range inside a character class
+                std::size_t RangeEnd() {
+                    if (Peek() != '\\') return static_cast<unsigned char>(m_pattern[m_position++]);
+
+                    ++m_position;
+                    const byte_set escaped{ Escape() };
+                    if (escaped.count() != 1) throw std::invalid_argument("Lexer: invalid range in character class.");
+                    std::size_t high{};
+                    while (!escaped.test(high)) ++high;
+                    return high;
+                }
+
+                static void AddRange(byte_set& xio_set, const std::size_t xi_low, const std::size_t xi_high) {
+                    if (xi_high < xi_low) throw std::invalid_argument("Lexer: invalid range in character class.");
+                    for (std::size_t i{ xi_low }; i <= xi_high; ++i) xio_set.set(i);
+                }
+        };
+
+        // a 16 byte at a time scanner over the bytes on which a DFA state loops on itself.
+        // bytes are classified using the "shufti" technique (two nibble lookups),
+        // which is exact as long as the looping set can be split into at most 8 buckets.
+        struct RunScanner {
+            alignas(16) std::uint8_t m_low[16];     // low nibble -> buckets
+            alignas(16) std::uint8_t m_high[16];    // high nibble -> buckets
+            bool                     m_enabled;
+
+            RunScanner() : m_low{}, m_high{}, m_enabled(false) {}
+
+            explicit RunScanner(const byte_set& xi_set) : m_low{}, m_high{}, m_enabled(false) {
+                if (xi_set.none()) return;
+
+                // group high nibbles by their low nibble mask
+                std::uint16_t masks[16]{},
+                              buckets[8]{};
+                std::size_t   bucketCount{};
+                for (std::size_t b{}; b < 256; ++b) {
+                    if (xi_set.test(b)) masks[b >> 4] |= static_cast<std::uint16_t>(1u << (b & 0x0F));
+                }
+
+                for (std::size_t h{}; h < 16; ++h) {
+                    if (masks[h] == 0) continue;
+
+                    std::size_t k{};
+                    while ((k < bucketCount) && (buckets[k] != masks[h])) ++k;
+                    if (k == bucketCount) {
+                        if (bucketCount == 8) return;
+                        buckets[bucketCount++] = masks[h];
+                    }
+
+                    m_high[h] |= static_cast<std::uint8_t>(1u << k);
+                }
+
+                for (std::size_t k{}; k < bucketCount; ++k) {
+                    for (std::size_t l{}; l < 16; ++l) {
+                        if (buckets[k] & (1u << l)) m_low[l] |= static_cast<std::uint8_t>(1u << k);
+                    }
+                }
+
+                m_enabled = true;
+            }
+
+#ifdef LEXER_SIMD_SCAN
+            // return position of first byte (starting at 'xi_position') which does not belong to the run
+            // (only full 16 byte blocks are scanned, remaining bytes should be handled by caller)
+            std::size_t Skip(const char* xi_data, std::size_t xi_position, const std::size_t xi_size) const noexcept {
+                const __m128i low{ _mm_load_si128(reinterpret_cast<const __m128i*>(m_low)) },
+                              high{ _mm_load_si128(reinterpret_cast<const __m128i*>(m_high)) },
+                              nibble{ _mm_set1_epi8(0x0F) },
+                              zero{ _mm_setzero_si128() };
+
+                while (xi_position + 16 <= xi_size) {
+                    const __m128i bytes{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(xi_data + xi_position)) },
+                                  lows{ _mm_shuffle_epi8(low, _mm_and_si128(bytes, nibble)) },
+                                  highs{ _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble)) },
+                                  outside{ _mm_cmpeq_epi8(_mm_and_si128(lows, highs), zero) };
+                    const unsigned mask{ static_cast<unsigned>(_mm_movemask_epi8(outside)) };
+
+                    if (mask != 0) {
+                        unsigned i{};
+                        while (((mask >> i) & 1u) == 0) ++i;
+                        return xi_position + i;
+                    }
+
+                    xi_position += 16;
+                }
+
+                return xi_position;
+            }
+#endif
+        };
+
+    // properties
+    private:
+        std::vector<Rule>        m_rules;        // token rules
+        std::uint8_t             m_classes[256]; // byte -> byte class
+        std::size_t              m_classCount;   // amount of byte classes
+        std::vector<state_type>  m_table;        // DFA transition table ([state * m_classCount + class] -> state)
+        std::vector<std::size_t> m_accept;       // DFA state -> index of accepted rule (or 'NoRule')
+        std::vector<RunScanner>  m_scanners;     // DFA state -> self loop scanner
+
+    // API
+    public:
+
+        // construct from collections of rules (first rule has the highest priority)
+        explicit Lexer(std::initializer_list<Rule> xi_rules) : m_rules(xi_rules), m_classes{}, m_classCount(0) { Compile(); }
+        explicit Lexer(const std::vector<Rule>& xi_rules)    : m_rules(xi_rules), m_classes{}, m_classCount(0) { Compile(); }
+
+        // amount of DFA states (including the 'dead' state)
+        std::size_t GetStateCount() const noexcept { return m_accept.size(); }
+
+        // amount of byte classes
+        std::size_t GetClassCount() const noexcept { return m_classCount; }
+
+        /**
+        * \brief match a single token starting at a given position (longest match, first rule wins ties)
+        *
+        * @param {string_view, in}  buffer
+        * @param {size_t,      in}  position in buffer (must be smaller than buffer size)
+        * @param {Token,       out} matched token (if no rule match - a one byte token with id 'Invalid')
+        **/
+        Token Match(std::string_view xi_source, const std::size_t xi_position) const noexcept {
+            std::size_t length{};
+            const std::size_t rule{ MatchRule(xi_source, xi_position, length) };
+
+            if (rule == NoRule) return { Invalid, xi_source.substr(xi_position, 1) };
+            return { m_rules[rule].m_id, xi_source.substr(xi_position, length) };
+        }
+
+        /**
+        * \brief match the next emitted (non skipped) token starting at a given position
+        *
+        * @param {string_view, in}  buffer
+        * @param {size_t,      in}  position in buffer, updated to the position following the token
+        * @param {Token,       out} matched token (text is empty if buffer was consumed)
+        **/
+        Token Next(std::string_view xi_source, std::size_t& xio_position) const noexcept {
+            while (xio_position < xi_source.size()) {
+                std::size_t length{};
+                const std::size_t position{ xio_position },
+                                  rule{ MatchRule(xi_source, position, length) };
+
+                if (rule == NoRule) {
+                    ++xio_position;
+                    return { Invalid, xi_source.substr(position, 1) };
+                }
+
+                xio_position += length;
+                if (!m_rules[rule].m_skip) return { m_rules[rule].m_id, xi_source.substr(position, length) };
+            }
+
+            return { Invalid, xi_source.substr(xi_source.size()) };
+        }
+
+    // internal helpers
+    private:
+
+        // return the index of the longest matching rule (or 'NoRule') and its length
+        std::size_t MatchRule(std::string_view xi_source, const std::size_t xi_position, std::size_t& xo_length) const noexcept {
+            assert(xi_position < xi_source.size());
+
+            const std::size_t size{ xi_source.size() };
+            const char*       data{ xi_source.data() };
+            std::size_t rule{ NoRule },
+                        i{ xi_position };
+            state_type state{ Start };
+
+            while (i < size) {
+                const state_type next{ m_table[state * m_classCount + m_classes[static_cast<unsigned char>(data[i])]] };
+                if (next == Dead) break;
+                state = next;
+                ++i;
+
+#ifdef LEXER_SIMD_SCAN
+                if (m_scanners[state].m_enabled) i = m_scanners[state].Skip(data, i, size);
+#endif
+
+                if (m_accept[state] != NoRule) {
+                    rule      = m_accept[state];
+                    xo_length = i - xi_position;
+                }
+            }
+
+            return rule;
+        }
+
+        // compile rules into a DFA
+        void Compile() {
+            if (m_rules.empty()) throw std::invalid_argument("Lexer: no rules were given.");
+
+            // rules to NFA (state 0 is the NFA initial state)
+            std::vector<NfaState> nfa(1);
+            for (std::size_t r{}; r < m_rules.size(); ++r) {
+                const Fragment fragment{ Parser(m_rules[r].m_pattern, nfa).Parse() };
+                nfa[fragment.m_end].m_rule = r;
+                nfa[0].m_epsilon.push_back(fragment.m_start);
+            }
+
+            // partition bytes into classes which are indistinguishable by all NFA transitions
+            std::vector<std::size_t> classes(256, 0);
+            m_classCount = 1;
+            for (const NfaState& s : nfa) {
+                if (s.m_next < 0) continue;
+
+                std::map<std::pair<std::size_t, bool>, std::size_t> refined;
+                for (std::size_t b{}; b < 256; ++b) {
+                    classes[b] = refined.emplace(std::make_pair(classes[b], s.m_set.test(b)), refined.size()).first->second;
+                }
+                m_classCount = refined.size();
+            }
+
+            std::vector<std::size_t> representative(m_classCount);
+            for (std::size_t b{ 256 }; b-- > 0;) {
+                m_classes[b] = static_cast<std::uint8_t>(classes[b]);
+                representative[classes[b]] = b;
+            }
+
+            // epsilon closure of a set of NFA states
+            auto closure = [&nfa](std::vector<int> xi_states) {
+                std::vector<bool> visited(nfa.size(), false);
+                std::vector<int>  stack(xi_states);
+                for (const int s : xi_states) visited[s] = true;
+
+                while (!stack.empty()) {
+                    const int s{ stack.back() };
+                    stack.pop_back();
+                    for (const int e : nfa[s].m_epsilon) {
+                        if (visited[e]) continue;
+                        visited[e] = true;
+                        xi_states.push_back(e);
+                        stack.push_back(e);
+                    }
+                }
+
+                std::sort(xi_states.begin(), xi_states.end());
+                return xi_states;
+            };
+
+            // subset construction
+            std::map<std::vector<int>, state_type> states;
+            std::vector<std::vector<int>>          subsets{ {}, closure({ 0 }) };
+            states.emplace(subsets[Dead], Dead);
+            states.emplace(subsets[Start], Start);
+
+            for (std::size_t s{ Start }; s < subsets.size(); ++s) {
+                m_table.resize((s + 1) * m_classCount, Dead);
+
+                for (std::size_t c{}; c < m_classCount; ++c) {
+                    std::vector<int> moves;
+                    for (const int n : subsets[s]) {
+                        if ((nfa[n].m_next >= 0) && nfa[n].m_set.test(representative[c])) moves.push_back(nfa[n].m_next);
+                    }
+                    if (moves.empty()) continue;
+
+                    std::vector<int> subset{ closure(std::move(moves)) };
+                    const auto inserted = states.emplace(subset, static_cast<state_type>(subsets.size()));
+                    if (inserted.second) subsets.push_back(std::move(subset));
+                    m_table[s * m_classCount + c] = inserted.first->second;
+                }
+            }
+            m_table.resize(subsets.size() * m_classCount, Dead);
+
+            // accepting states
+            m_accept.assign(subsets.size(), NoRule);
+            for (std::size_t s{ Start }; s < subsets.size(); ++s) {
+                for (const int n : subsets[s]) {
+                    m_accept[s] = std::min(m_accept[s], nfa[n].m_rule);
+                }
+            }
+            if (m_accept[Start] != NoRule) throw std::invalid_argument("Lexer: a pattern matches the empty string.");
+
+            // self loop scanners
+            m_scanners.assign(subsets.size(), RunScanner());
+            for (std::size_t s{ Start }; s < subsets.size(); ++s) {
+                byte_set loop;
+                for (std::size_t b{}; b < 256; ++b) {
+                    if (m_table[s * m_classCount + m_classes[b]] == s) loop.set(b);
+                }
+                m_scanners[s] = RunScanner(loop);
+            }
+        }
+};
+
+/**
+* \brief a lazy view over the tokens of a given buffer
+**/
+class TokenView {
+    // properties
+    private:
+        std::string_view m_source;
+        const Lexer&     m_lexer;
+
+    // methods
+    public:
+
+        /**
+        * Iterator over the tokens
+        */
+        class iterator {
+            public:
+                // aliases
+                using difference_type   = std::ptrdiff_t;
+                using value_type        = Lexer::Token;
+                using pointer           = const value_type*;
+                using reference         = const value_type&;
+                using iterator_category = std::input_iterator_tag;
+
+            // properties
+            private:
+                const Lexer*     m_lexer;
+                std::string_view m_source;
+                std::size_t      m_position;
+                value_type       m_current;
+
+            // methods
+            public:
+
+                constexpr iterator() noexcept : m_lexer(nullptr), m_source(), m_position(0), m_current{ Lexer::Invalid, {} } {}
+                explicit iterator(std::string_view src, const Lexer& lexer) : m_lexer(&lexer), m_source(src), m_position(0), m_current{ Lexer::Invalid, {} } {
+                    ++*this;
+                }
+
+                reference operator*() const noexcept {
+                    assert(m_lexer != nullptr);
+                    return m_current;
+                }
+
+                pointer operator->() const noexcept {
+                    assert(m_lexer != nullptr);
+                    return &m_current;
+                }
+
+                iterator& operator++() {
+                    assert(m_lexer != nullptr);
+                    if (m_position >= m_source.size()) {
+                        m_lexer = nullptr;
+                        m_position = 0;
+                        return *this;
+                    }
+
+                    m_current = m_lexer->Next(m_source, m_position);
+                    if (m_current.m_text.empty()) {
+                        m_lexer = nullptr;
+                        m_position = 0;
+                    }
+
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator temp(*this);
+                    ++*this;
+                    return temp;
+                }
+
+                bool operator==(const iterator& rhs) const noexcept {
+                    return (m_lexer == rhs.m_lexer) && (m_position == rhs.m_position);
+                }
+                bool operator!=(const iterator& rhs) const noexcept {
+                    return !operator==(rhs);
+                }
+        };
+
+        /**
+        * Constructor.
+        *
+        * @param src    the source buffer to be tokenized (should outlive the view)
+        * @param lexer  lexer used to tokenize \a src (should outlive the view)
+        */
+        explicit TokenView(std::string_view src, const Lexer& lexer) noexcept : m_source(src), m_lexer(lexer) {}
+
+        iterator begin() const {
+            return iterator(m_source, m_lexer);
+        }
+
+        iterator end() const noexcept {
+            return iterator();
+        }
+
+        /** Converts the view to a token vector. */
+        std::vector<Lexer::Token> to_vector() const {
+            std::vector<Lexer::Token> result;
+            for (const auto& token : *this) result.push_back(token);
+            return result;
+        }
+
+        /** Converts the view to a string_view vector (tokens text). **/
+        std::vector<std::string_view> to_vector_sv() const {
+            std::vector<std::string_view> result;
+            for (const auto& token : *this) result.push_back(token.m_text);
+            return result;
+        }
+};
+
+/**
+ * Tokenize a buffer into a lazy view of tokens.  The buffer shall
+ * remain unchanged when the generated TokenView is used in anyway.
+ *
+ * @param src    the source input to be tokenized
+ * @param lexer  lexer used to tokenize \a src
+ */
+inline TokenView tokenize(std::string_view src, const Lexer& lexer) noexcept {
+    return TokenView(src, lexer);
+}
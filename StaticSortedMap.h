@@ -0,0 +1,252 @@
+/**
+* A static (built once, read only) sorted bi-directional map for a large amount of entries.
+*
+* keys (and values, for reverse lookup) are stored in an 'Eytzinger' (breadth first, implicit binary tree) layout,
+* so the first levels of the search share a few cache lines, and the next levels of the search are prefetched
+* while the current level is compared (a lookup is a branch free loop with no pointer chasing).
+* entries are also kept in sorted (SoA) order, for range queries and iteration.
+*
+* example usage:
+*
+*   std::vector<std::pair<std::uint32_t, std::uint32_t>> entries{ { 10, 1 }, { 20, 2 }, { 30, 3 }, { 40, 4 } };
+*   const StaticSortedMap<std::uint32_t, std::uint32_t> map(entries);
+*
+*   if (auto value = map.find(30)) std::cout << *value << "\n";    // 3
+*   if (auto key = map.find_key(2)) std::cout << *key << "\n";     // 20
+*
+*   std::cout << map.key_at(map.lower_bound(25)) << "\n";          // 30
+*
+*   const auto [first, last] = map.range(15, 35);                  // keys in [15, 35)
+*   for (std::size_t i{ first }; i < last; ++i) std::cout << map.key_at(i) << " : " << map.value_at(i) << "\n";
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include<algorithm>
+#include<assert.h>
+#include<cstdint>
+#include<numeric>
+#include<optional>
+#include<utility>
+#include<vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define STATIC_SORTED_MAP_PREFETCH
+#include<xmmintrin.h>
+#endif
+
+namespace StaticSortedMapDetail {
+
+    /**
+    * \brief an 'Eytzinger' layout search index over a sorted sequence.
+    *        node k (1 based) has children 2k and 2k+1, its sorted rank is derived from k (in order index).
+    **/
+    template<typename T> class Eytzinger {
+        // properties
+        private:
+            std::vector<T> m_tree;      // 1 based (index 0 is unused)
+            unsigned       m_depth{};   // depth of the last (possibly partial) tree level
+
+        // constructor
+        public:
+            Eytzinger() : m_tree(1) {}
+
+            explicit Eytzinger(const std::vector<T>& xi_sorted) : m_tree(xi_sorted.size() + 1),
+                                                                  m_depth(xi_sorted.empty() ? 0 : Log2(xi_sorted.size())) {
+                std::size_t i{};
+                Build(xi_sorted, i, 1);
+            }
+
+        // API
+        public:
+
+            /**
+            * \brief return the sorted rank of the first element which is not less then a given value
+            *
+            * @param {T,      in}  value
+            * @param {size_t, out} rank (amount of elements if all elements are less then value)
+            **/
+            std::size_t lower_bound(const T& xi_value) const noexcept {
+                // amount of nodes sharing a cache line, search is prefetched log2(Stride) levels ahead
+                constexpr std::size_t Stride{ (sizeof(T) < 64) ? 64 / sizeof(T) : 1 };
+
+                const std::size_t n{ m_tree.size() - 1 };
+                const T* tree{ m_tree.data() };
+
+                std::size_t k{ 1 };
+                while (k <= n) {
+#ifdef STATIC_SORTED_MAP_PREFETCH
+                    _mm_prefetch(reinterpret_cast<const char*>(tree + std::min(k * Stride, n)), _MM_HINT_T0);
+#endif
+                    k = 2 * k + static_cast<std::size_t>(tree[k] < xi_value);
+                }
+
+                // the answer is the last node in which the search turned left (remove trailing 'right' turns and one 'left' turn)
+                k >>= TrailingOnes(k) + 1;
+                return (k == 0) ? n : Rank(k);
+            }
+
+        // internal helpers
+        private:
+
+            // in order traversal of the implicit tree
+            void Build(const std::vector<T>& xi_sorted, std::size_t& xio_i, const std::size_t xi_k) {
+                if (xi_k > xi_sorted.size()) return;
+                Build(xi_sorted, xio_i, 2 * xi_k);
+                m_tree[xi_k] = xi_sorted[xio_i++];
+                Build(xi_sorted, xio_i, 2 * xi_k + 1);
+            }
+
+            /**
+            * \brief return the in order index (sorted rank) of a given node.
+            *        the rank is first computed as if the last level was full, and then
+            *        the absent last level nodes which precede it (in order) are removed.
+            *
+            * @param {size_t, in}  node (1 based)
+            * @param {size_t, out} sorted rank
+            **/
+            std::size_t Rank(const std::size_t xi_k) const noexcept {
+                const unsigned depth{ Log2(xi_k) };
+                const unsigned below{ m_depth - depth };
+                const std::size_t full{ ((2 * (xi_k - (std::size_t{ 1 } << depth)) + 1) << below) - 1 };
+                const std::size_t last{ m_tree.size() - (std::size_t{ 1 } << m_depth) };  // amount of nodes in last level
+                const std::size_t slots{ (full + 1) / 2 };                                // last level slots before node
+                return (slots > last) ? full - (slots - last) : full;
+            }
+
+            static unsigned Log2(const std::size_t xi_value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<unsigned>(63 - __builtin_clzll(static_cast<unsigned long long>(xi_value)));
+#else
+                unsigned i{};
+                while (xi_value >> (i + 1)) ++i;
+                return i;
+#endif
+            }
+
+            static unsigned TrailingOnes(const std::size_t xi_value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<unsigned>(__builtin_ctzll(~static_cast<unsigned long long>(xi_value)));
+#else
+                unsigned i{};
+                while ((xi_value >> i) & 1u) ++i;
+                return i;
+#endif
+            }
+    };
+}
+
+/**
+* \brief static sorted bi-directional map
+*
+* @param {K} key type (less then comparable)
+* @param {V} value type (less then comparable)
+**/
+template<typename K, typename V> class StaticSortedMap {
+    // properties
+    private:
+        // entries sorted by key
+        std::vector<K> m_keys;
+        std::vector<V> m_values;
+        StaticSortedMapDetail::Eytzinger<K> m_keysIndex;
+
+        // entries sorted by value (ties ordered by key)
+        std::vector<V> m_reverseValues;
+        std::vector<K> m_reverseKeys;
+        StaticSortedMapDetail::Eytzinger<V> m_valuesIndex;
+
+    // constructor
+    public:
+        StaticSortedMap() = default;
+
+        /**
+        * \brief build map from a collection of <key, value> pairs (need not be sorted, duplicate keys are allowed)
+        *
+        * @param {vector, in} <key, value> pairs
+        **/
+        explicit StaticSortedMap(std::vector<std::pair<K, V>> xi_entries) {
+            const auto byKey = [](const std::pair<K, V>& a, const std::pair<K, V>& b) { return a.first < b.first; };
+            if (!std::is_sorted(xi_entries.begin(), xi_entries.end(), byKey)) {
+                std::stable_sort(xi_entries.begin(), xi_entries.end(), byKey);
+            }
+
+            m_keys.reserve(xi_entries.size());
+            m_values.reserve(xi_entries.size());
+            for (const auto& entry : xi_entries) {
+                m_keys.push_back(entry.first);
+                m_values.push_back(entry.second);
+            }
+            m_keysIndex = StaticSortedMapDetail::Eytzinger<K>(m_keys);
+
+            std::vector<std::size_t> order(m_values.size());
+            std::iota(order.begin(), order.end(), std::size_t{});
+            std::stable_sort(order.begin(), order.end(), [this](const std::size_t a, const std::size_t b) { return m_values[a] < m_values[b]; });
+
+            m_reverseValues.reserve(order.size());
+            m_reverseKeys.reserve(order.size());
+            for (const std::size_t i : order) {
+                m_reverseValues.push_back(m_values[i]);
+                m_reverseKeys.push_back(m_keys[i]);
+            }
+            m_valuesIndex = StaticSortedMapDetail::Eytzinger<V>(m_reverseValues);
+        }
+
+    // API
+    public:
+
+        // amount of entries
+        std::size_t size() const noexcept { return m_keys.size(); }
+
+        bool empty() const noexcept { return m_keys.empty(); }
+
+        // entries in key order (SoA)
+        const K& key_at(const std::size_t i) const noexcept { assert(i < size()); return m_keys[i]; }
+        const V& value_at(const std::size_t i) const noexcept { assert(i < size()); return m_values[i]; }
+        const std::vector<K>& keys() const noexcept { return m_keys; }
+        const std::vector<V>& values() const noexcept { return m_values; }
+
+        /**
+        * \brief return the (key order) index of the first entry whose key is not less then a given key
+        *
+        * @param {K,      in}  key
+        * @param {size_t, out} index ('size()' if all keys are less then given key)
+        **/
+        std::size_t lower_bound(const K& xi_key) const noexcept { return m_keysIndex.lower_bound(xi_key); }
+
+        /**
+        * \brief return the (key order) index range of entries whose key is in [xi_first, xi_last)
+        *
+        * @param {K,    in}  first key (inclusive)
+        * @param {K,    in}  last key (exclusive)
+        * @param {pair, out} [first index, last index)
+        **/
+        std::pair<std::size_t, std::size_t> range(const K& xi_first, const K& xi_last) const noexcept {
+            const std::size_t first{ lower_bound(xi_first) };
+            return { first, std::max(first, lower_bound(xi_last)) };
+        }
+
+        /**
+        * \brief given a key, return its value (if several entries share the key - the first one)
+        *
+        * @param {K,        in}  key
+        * @param {optional, out} value (empty if key does not exist in map)
+        **/
+        std::optional<V> find(const K& xi_key) const noexcept {
+            const std::size_t i{ lower_bound(xi_key) };
+            return ((i < size()) && !(xi_key < m_keys[i])) ? std::optional<V>(m_values[i]) : std::nullopt;
+        }
+
+        /**
+        * \brief given a value, return its key (if several entries share the value - the one with the smallest key)
+        *
+        * @param {V,        in}  value
+        * @param {optional, out} key (empty if value does not exist in map)
+        **/
+        std::optional<K> find_key(const V& xi_value) const noexcept {
+            const std::size_t i{ m_valuesIndex.lower_bound(xi_value) };
+            return ((i < size()) && !(xi_value < m_reverseValues[i])) ? std::optional<K>(m_reverseKeys[i]) : std::nullopt;
+        }
+
+        // test if a given key exists in map
+        bool contains(const K& xi_key) const noexcept { return find(xi_key).has_value(); }
+};
@@ -3,7 +3,10 @@
 *
 * Dan Israel Malta
 **/
+#pragma once
 #include <type_traits>
+#include <cstddef>
+#include <utility>
 
 // parameter pack related operations
 namespace Pack {
@@ -14,15 +17,32 @@ namespace Pack {
     namespace detail {
 
         // get parameter pack element at index I
+        // (constant instantiation depth - a compiler intrinsic if available, otherwise overload resolution against indexed bases)
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define TYPELIST_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+#ifdef TYPELIST_HAS_TYPE_PACK_ELEMENT
         template<std::size_t I, typename T, typename...Ts>
         struct nth_element_impl {
             static_assert(I <= sizeof...(Ts));
-            using type = typename nth_element_impl<I - 1, Ts...>::type;
+            using type = __type_pack_element<I, T, Ts...>;
         };
-        template<typename T, typename ...Ts>
-        struct nth_element_impl<0, T, Ts...> {
-            using type = T;
+#else
+        template<std::size_t I, typename T> struct indexed { using type = T; };
+        template<typename S, typename...Ts> struct indexer;
+        template<std::size_t...Is, typename...Ts>
+        struct indexer<std::index_sequence<Is...>, Ts...> : indexed<Is, Ts>... {};
+        template<std::size_t I, typename T> indexed<I, T> select(const indexed<I, T>&);
+
+        template<std::size_t I, typename T, typename...Ts>
+        struct nth_element_impl {
+            static_assert(I <= sizeof...(Ts));
+            using type = typename decltype(select<I>(indexer<std::index_sequence_for<T, Ts...>, T, Ts...>{}))::type;
         };
+#endif
+#undef TYPELIST_HAS_TYPE_PACK_ELEMENT
 
         // test if type {@T} exists in a pack
         template<typename T, typename...Args>
@@ -148,17 +168,18 @@ namespace DataStructure {
         };
 
         // return index of a given type (if the type has multiple occurences, return the first one from the tail)
-        template<std::size_t I, typename T, typename SEQ> struct index_of_type_impl;
-        template<std::size_t I, typename T, template<typename...> class SEQ, typename... Ts>
-        struct index_of_type_impl<I, T, SEQ<Ts...>> {
-            static_assert(I <= sizeof...(Ts));
-            using type = std::conditional_t<std::is_same<T, Pack::element_at_index<I, Ts...>>::value,
-                                            std::integral_constant<std::size_t, I>, 
-                                            typename index_of_type_impl<I - 1, T, SEQ<Ts...>>::type>;
-        };
+        // (0 if the type does not exist)
+        template<typename T, typename... Ts>
+        constexpr std::size_t last_index_of() noexcept {
+            constexpr bool match[]{ false, std::is_same<T, Ts>::value... };
+            std::size_t i{ sizeof...(Ts) };
+            while ((i > 1) && !match[i]) --i;
+            return (i > 0) ? i - 1 : 0;
+        }
+        template<typename T, typename SEQ> struct index_of_type_impl;
         template<typename T, template<typename...> class SEQ, typename... Ts>
-        struct index_of_type_impl<0, T, SEQ<Ts...>> {
-            using type = std::integral_constant<std::size_t, 0>;
+        struct index_of_type_impl<T, SEQ<Ts...>> {
+            using type = std::integral_constant<std::size_t, last_index_of<T, Ts...>()>;
         };
     }
     
@@ -195,7 +216,7 @@ namespace DataStructure {
 
     // return index of type T in a type_list (T must be inside type_list)
     // (if the type has multiple occurences, return the first one from the tail)
-    template<typename T, typename SEQ> using index_of = typename detail::index_of_type_impl<size<SEQ>::value - 1, T, SEQ>::type;
+    template<typename T, typename SEQ> using index_of = typename detail::index_of_type_impl<T, SEQ>::type;
 
     //
     // tests
@@ -0,0 +1,259 @@
+/**
+* Variable length integer codecs (compact serialization of integer arrays).
+*
+* > zigzag     - maps signed integers to unsigned ones such that small magnitudes become small values (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...).
+* > LEB128     - 7 bits per byte, high bit marks continuation. signed integers are zigzag encoded.
+* > group varint - 32bit integers are encoded in groups of four: a tag byte (2 bits per integer holding its length - 1)
+*                followed by the integers least significant bytes. decoding a group is a single byte shuffle
+*                (requires SSSE3, otherwise a scalar decode is performed).
+*
+* example usage:
+*
+*   const std::vector<std::uint32_t> ids{ 1, 300, 70000, 5, 2 };
+*
+*   std::vector<std::uint8_t> buffer(VarInt::max_group_varint_size(ids.size()));
+*   buffer.resize(VarInt::encode_group_varint(ids.data(), ids.size(), buffer.data()));
+*
+*   std::vector<std::uint32_t> decoded(ids.size());
+*   VarInt::decode_group_varint(buffer.data(), buffer.size(), decoded.data(), decoded.size());
+*
+*   const std::vector<std::int64_t> deltas{ -3, 0, 17, -1000 };
+*   std::vector<std::uint8_t> leb(VarInt::max_leb128_size<std::int64_t>(deltas.size()));
+*   leb.resize(VarInt::encode_leb128(deltas.data(), deltas.size(), leb.data()));
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<stdexcept>
+#include<type_traits>
+
+#if defined(__SSSE3__) || defined(_MSC_VER)
+#define VARINT_SIMD_DECODE
+#include<immintrin.h>
+#endif
+
+namespace VarInt {
+
+    /**
+    * \brief zigzag encoding of a signed integer
+    *
+    * @param {T, in}  signed integer
+    * @param {U, out} unsigned integer
+    **/
+    template<typename T> constexpr std::make_unsigned_t<T> zigzag_encode(const T x) noexcept {
+        static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "zigzag_encode: 'T' must be a signed integral type.");
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>((static_cast<U>(x) << 1) ^ static_cast<U>(x < 0 ? ~U{} : U{}));
+    }
+
+    /**
+    * \brief zigzag decoding of an unsigned integer
+    *
+    * @param {U, in}  unsigned integer
+    * @param {T, out} signed integer
+    **/
+    template<typename U> constexpr std::make_signed_t<U> zigzag_decode(const U x) noexcept {
+        static_assert(std::is_integral<U>::value && std::is_unsigned<U>::value, "zigzag_decode: 'U' must be an unsigned integral type.");
+        return static_cast<std::make_signed_t<U>>((x >> 1) ^ (~(x & 1) + 1));
+    }
+
+    //
+    // LEB128
+    //
+
+    // maximal amount of bytes required to LEB128 encode 'xi_count' integers of type T
+    template<typename T> constexpr std::size_t max_leb128_size(const std::size_t xi_count) noexcept {
+        return xi_count * ((sizeof(T) * 8 + 6) / 7);
+    }
+
+    /**
+    * \brief LEB128 encode an array of integers (signed integers are zigzag encoded)
+    *
+    * @param {T*,       in}  integers
+    * @param {size_t,   in}  amount of integers
+    * @param {uint8_t*, out} output buffer (at least 'max_leb128_size<T>(xi_count)' bytes long)
+    * @param {size_t,   out} amount of bytes written
+    **/
+    template<typename T> std::size_t encode_leb128(const T* xi_in, const std::size_t xi_count, std::uint8_t* xo_out) noexcept {
+        static_assert(std::is_integral<T>::value, "encode_leb128: 'T' must be an integral type.");
+
+        std::uint8_t* out{ xo_out };
+        for (std::size_t i{}; i < xi_count; ++i) {
+            std::uint64_t v;
+            if constexpr (std::is_signed<T>::value) v = zigzag_encode(xi_in[i]);
+            else                                    v = xi_in[i];
+
+            while (v >= 0x80) {
+                *out++ = static_cast<std::uint8_t>(v | 0x80);
+                v >>= 7;
+            }
+            *out++ = static_cast<std::uint8_t>(v);
+        }
+
+        return static_cast<std::size_t>(out - xo_out);
+    }
+
+    /**
+    * \brief decode an array of LEB128 encoded integers (signed integers are zigzag decoded).
+    *        throws 'std::invalid_argument' if input is truncated or holds a value which does not fit in T.
+    *
+    * @param {uint8_t*, in}  encoded buffer
+    * @param {size_t,   in}  encoded buffer size
+    * @param {T*,       out} decoded integers
+    * @param {size_t,   in}  amount of integers to decode
+    * @param {size_t,   out} amount of bytes consumed
+    **/
+    template<typename T> std::size_t decode_leb128(const std::uint8_t* xi_in, const std::size_t xi_size, T* xo_out, const std::size_t xi_count) {
+        static_assert(std::is_integral<T>::value, "decode_leb128: 'T' must be an integral type.");
+        using U = std::make_unsigned_t<T>;
+        constexpr std::size_t Bits{ sizeof(T) * 8 };
+
+        const std::uint8_t* in{ xi_in };
+        const std::uint8_t* const end{ xi_in + xi_size };
+        for (std::size_t i{}; i < xi_count; ++i) {
+            if (in == end) throw std::invalid_argument("VarInt: truncated LEB128 input.");
+
+            std::uint64_t v{ *in++ };
+            if (v >= 0x80) {
+                v &= 0x7F;
+                std::size_t shift{ 7 };
+                for (;;) {
+                    if (in == end) throw std::invalid_argument("VarInt: truncated LEB128 input.");
+                    if (shift >= Bits) throw std::invalid_argument("VarInt: LEB128 value overflows output type.");
+
+                    const std::uint64_t byte{ *in++ };
+                    if ((Bits - shift < 7) && (((byte & 0x7F) >> (Bits - shift)) != 0)) throw std::invalid_argument("VarInt: LEB128 value overflows output type.");
+                    v |= (byte & 0x7F) << shift;
+                    if (byte < 0x80) break;
+                    shift += 7;
+                }
+            }
+
+            if constexpr (std::is_signed<T>::value) xo_out[i] = zigzag_decode(static_cast<U>(v));
+            else                                    xo_out[i] = static_cast<T>(v);
+        }
+
+        return static_cast<std::size_t>(in - xi_in);
+    }
+
+    //
+    // group varint
+    //
+
+    // maximal amount of bytes required to group varint encode 'xi_count' integers
+    constexpr std::size_t max_group_varint_size(const std::size_t xi_count) noexcept {
+        return ((xi_count + 3) / 4) * 17;
+    }
+
+    namespace detail {
+
+        // amount of bytes required to hold a value (1 to 4)
+        inline std::size_t length(const std::uint32_t v) noexcept {
+            return 1 + static_cast<std::size_t>(v > 0xFF) + static_cast<std::size_t>(v > 0xFFFF) + static_cast<std::size_t>(v > 0xFFFFFF);
+        }
+
+        // group tag -> group data length
+        constexpr std::array<std::uint8_t, 256> make_lengths() noexcept {
+            std::array<std::uint8_t, 256> lengths{};
+            for (std::size_t tag{}; tag < 256; ++tag) {
+                std::size_t sum{};
+                for (std::size_t j{}; j < 4; ++j) sum += ((tag >> (2 * j)) & 3) + 1;
+                lengths[tag] = static_cast<std::uint8_t>(sum);
+            }
+            return lengths;
+        }
+        inline constexpr std::array<std::uint8_t, 256> lengths{ make_lengths() };
+
+        // group tag -> byte shuffle which spreads group data into four 32bit lanes
+        constexpr std::array<std::array<std::uint8_t, 16>, 256> make_shuffles() noexcept {
+            std::array<std::array<std::uint8_t, 16>, 256> shuffles{};
+            for (std::size_t tag{}; tag < 256; ++tag) {
+                std::size_t offset{};
+                for (std::size_t j{}; j < 4; ++j) {
+                    const std::size_t len{ ((tag >> (2 * j)) & 3) + 1 };
+                    for (std::size_t k{}; k < 4; ++k) {
+                        shuffles[tag][4 * j + k] = (k < len) ? static_cast<std::uint8_t>(offset + k) : 0x80;
+                    }
+                    offset += len;
+                }
+            }
+            return shuffles;
+        }
+        alignas(16) inline constexpr std::array<std::array<std::uint8_t, 16>, 256> shuffles{ make_shuffles() };
+    }
+
+    /**
+    * \brief group varint encode an array of 32bit integers
+    *        (a partial last group is padded with zeros)
+    *
+    * @param {uint32_t*, in}  integers
+    * @param {size_t,    in}  amount of integers
+    * @param {uint8_t*,  out} output buffer (at least 'max_group_varint_size(xi_count)' bytes long)
+    * @param {size_t,    out} amount of bytes written
+    **/
+    inline std::size_t encode_group_varint(const std::uint32_t* xi_in, const std::size_t xi_count, std::uint8_t* xo_out) noexcept {
+        std::uint8_t* out{ xo_out };
+        for (std::size_t i{}; i < xi_count; i += 4) {
+            std::uint8_t* tag{ out++ };
+            *tag = 0;
+            for (std::size_t j{}; j < 4; ++j) {
+                const std::uint32_t v{ (i + j < xi_count) ? xi_in[i + j] : 0u };
+                const std::size_t len{ detail::length(v) };
+                *tag = static_cast<std::uint8_t>(*tag | ((len - 1) << (2 * j)));
+                for (std::size_t k{}; k < len; ++k) {
+                    *out++ = static_cast<std::uint8_t>(v >> (8 * k));
+                }
+            }
+        }
+
+        return static_cast<std::size_t>(out - xo_out);
+    }
+
+    /**
+    * \brief decode an array of group varint encoded 32bit integers.
+    *        throws 'std::invalid_argument' if input is truncated.
+    *
+    * @param {uint8_t*,  in}  encoded buffer
+    * @param {size_t,    in}  encoded buffer size
+    * @param {uint32_t*, out} decoded integers
+    * @param {size_t,    in}  amount of integers to decode
+    * @param {size_t,    out} amount of bytes consumed
+    **/
+    inline std::size_t decode_group_varint(const std::uint8_t* xi_in, const std::size_t xi_size, std::uint32_t* xo_out, const std::size_t xi_count) {
+        const std::uint8_t* in{ xi_in };
+        const std::uint8_t* const end{ xi_in + xi_size };
+        std::size_t i{};
+
+#ifdef VARINT_SIMD_DECODE
+        // full groups whose 16 data bytes can be safely loaded
+        for (; (i + 4 <= xi_count) && (end - in >= 17); i += 4) {
+            const std::uint8_t tag{ *in };
+            const __m128i data{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 1)) },
+                          shuffle{ _mm_load_si128(reinterpret_cast<const __m128i*>(detail::shuffles[tag].data())) };
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(xo_out + i), _mm_shuffle_epi8(data, shuffle));
+            in += 1 + detail::lengths[tag];
+        }
+#endif
+
+        for (; i < xi_count; i += 4) {
+            if (in == end) throw std::invalid_argument("VarInt: truncated group varint input.");
+            const std::uint8_t tag{ *in++ };
+            if (static_cast<std::size_t>(end - in) < detail::lengths[tag]) throw std::invalid_argument("VarInt: truncated group varint input.");
+
+            for (std::size_t j{}; j < 4; ++j) {
+                const std::size_t len{ static_cast<std::size_t>((tag >> (2 * j)) & 3) + 1 };
+                std::uint32_t v{};
+                for (std::size_t k{}; k < len; ++k) {
+                    v |= static_cast<std::uint32_t>(in[k]) << (8 * k);
+                }
+                in += len;
+                if (i + j < xi_count) xo_out[i + j] = v;
+            }
+        }
+
+        return static_cast<std::size_t>(in - xi_in);
+    }
+}
@@ -1,7 +1,79 @@
 /**
 * Dan Israel Malta
 **/
+#pragma once
+
+#include <cstddef>
+#include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace EnumerateDetail {
+
+    // iterator category of an enumeration (at most random access)
+    template<typename TIter, typename Category = typename std::iterator_traits<TIter>::iterator_category>
+    using category_t = std::conditional_t<std::is_base_of_v<std::random_access_iterator_tag, Category>, std::random_access_iterator_tag,
+                       std::conditional_t<std::is_base_of_v<std::bidirectional_iterator_tag, Category>, std::bidirectional_iterator_tag,
+                       std::conditional_t<std::is_base_of_v<std::forward_iterator_tag, Category>, std::forward_iterator_tag, std::input_iterator_tag>>>;
+
+    template<typename TIter> inline constexpr bool is_random_access_v = std::is_same_v<category_t<TIter>, std::random_access_iterator_tag>;
+
+    /**
+    * \brief enumeration iterator, dereferences to (index, element reference).
+    *        it has the category of the enumerated iterator (up to random access), and the index of a random access
+    *        iterator follows its offset, so it can jump.
+    **/
+    template<typename TIter> struct iterator {
+        using iterator_category = category_t<TIter>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::tuple<std::size_t, typename std::iterator_traits<TIter>::reference>;
+        using value_type        = reference;
+        using pointer           = void;
+
+        std::size_t i;
+        TIter iter;
+
+        // access
+        reference operator * () const { return reference(i, *iter); }
+        reference operator [] (const difference_type n) const { return reference(i + n, iter[n]); }
+
+        // movement (backward and random access movement require a matching enumerated iterator)
+        iterator& operator ++ ()    { ++i; ++iter; return *this; }
+        iterator& operator -- ()    { --i; --iter; return *this; }
+        iterator  operator ++ (int) { iterator temp{ *this }; ++*this; return temp; }
+        iterator  operator -- (int) { iterator temp{ *this }; --*this; return temp; }
+        iterator& operator += (const difference_type n) { i += n; iter += n; return *this; }
+        iterator& operator -= (const difference_type n) { i -= n; iter -= n; return *this; }
+        friend iterator operator + (iterator it, const difference_type n) { return it += n; }
+        friend iterator operator + (const difference_type n, iterator it) { return it += n; }
+        friend iterator operator - (iterator it, const difference_type n) { return it -= n; }
+        friend difference_type operator - (const iterator & a, const iterator & b) { return a.iter - b.iter; }
+
+        // comparison
+        friend bool operator == (const iterator & a, const iterator & b) { return a.iter == b.iter; }
+        friend bool operator != (const iterator & a, const iterator & b) { return a.iter != b.iter; }
+        friend bool operator <  (const iterator & a, const iterator & b) { return a.iter < b.iter; }
+        friend bool operator >  (const iterator & a, const iterator & b) { return a.iter > b.iter; }
+        friend bool operator <= (const iterator & a, const iterator & b) { return a.iter <= b.iter; }
+        friend bool operator >= (const iterator & a, const iterator & b) { return a.iter >= b.iter; }
+    };
+
+    // wrapper over enumerable object
+    template<typename T, typename TIter> struct iterable_wrapper {
+        T iterable;
+
+        auto begin() { return iterator<TIter>{ 0, std::begin(iterable) }; }
+        auto end()   {
+            // end index is known (in constant time) only for random access objects
+            if constexpr (is_random_access_v<TIter>) return iterator<TIter>{ size(), std::end(iterable) };
+            else                                     return iterator<TIter>{ 0, std::end(iterable) };
+        }
+
+        // amount of elements (random access objects only)
+        std::size_t size() { return static_cast<std::size_t>(std::end(iterable) - std::begin(iterable)); }
+    };
+}
 
 /**
 * \brief allow enumeration of a list of things
@@ -17,28 +89,18 @@
 *           // i gets the index and thing gets the Thing in each iteration
 *        }
 *
+*        example #3:
+*        enumeration of a random access object is random access (index is calculated from offset),
+*        so it can be used with (parallel) standard algorithms:
+*        auto indexed = enumerate(things);
+*        std::for_each(std::execution::par, indexed.begin(), indexed.end(), [](auto element) {
+*           auto [i, thing] = element;
+*           // ...
+*        });
+*
 * @param {T, in} enumeratable object
 **/
 template<typename T, typename TIter = decltype(std::begin(std::declval<T>())), typename = decltype(std::end(std::declval<T>()))>
 constexpr auto enumerate(T && iterable) {
-    // iterator
-    struct iterator {
-        std::size_t i;
-        TIter iter;
-
-        bool operator != (const iterator & other) const { return iter != other.iter; }
-        void operator ++ ()                             { ++i; ++iter; }
-        auto operator *  ()                       const { return std::tie(i, *iter); }
-    };
-
-    // wrapper over enumerable object
-    struct iterable_wrapper {
-        T iterable;
-
-        auto begin() { return iterator{ 0, std::begin(iterable) }; }
-        auto end()   { return iterator{ 0, std::end(iterable) };   }
-    };
-
-    // output
-    return iterable_wrapper{ std::forward<T>(iterable) };
+    return EnumerateDetail::iterable_wrapper<T, TIter>{ std::forward<T>(iterable) };
 }
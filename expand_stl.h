@@ -12,6 +12,21 @@
 #include <algorithm>
 #include <tuple>
 #include <array>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define EXPAND_STL_SIMD
+#include <emmintrin.h>
+#endif
+
 
 // type traits
 namespace {
@@ -29,6 +44,724 @@ namespace {
 
     // test if all elements are of identical types and are not iterate-able collections
     template<typename...Args> constexpr bool are_homogeneous_pack = !are_iterate_able_v<Args...> && all_same_v<Args...>;
+
+    // test if an execution policy is sequential
+    template<class ExecutionPolicy> inline constexpr bool is_sequenced_policy_v = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+}
+
+// helpers which treat a variadic amount of collections as a single concatenated index space
+namespace ExpandStlDetail {
+
+    // minimal amount of elements processed by a single task
+    inline constexpr std::size_t Grain{ 4096 };
+
+    // amount of elements in each collection
+    template<class...Containers> std::array<std::size_t, sizeof...(Containers)> sizes(const Containers&... xi_containers) {
+        return { { static_cast<std::size_t>(std::distance(std::begin(xi_containers), std::end(xi_containers)))... } };
+    }
+
+    // amount of tasks by which 'xi_count' elements are split (one per hardware thread, each holding at least 'Grain' elements)
+    inline std::size_t task_count(const std::size_t xi_count) {
+        const std::size_t threads{ std::max<std::size_t>(1, std::thread::hardware_concurrency()) };
+        return std::clamp<std::size_t>(xi_count / Grain, 1, threads);
+    }
+
+    /**
+    * \brief split elements [xi_first, xi_last) of the concatenation of several collections into per collection
+    *        iterator ranges, and apply a function on each (non empty) range, in order.
+    *
+    * @param {size_t,      in} index of first element
+    * @param {size_t,      in} index of one past last element
+    * @param {Function,    in} function accepting a [begin, end) iterator pair
+    * @param {array,       in} amount of elements in each collection (see 'sizes')
+    * @param {collections, in} collections
+    **/
+    template<class Function, class...Containers>
+    void for_each_range(const std::size_t xi_first, const std::size_t xi_last, Function&& xi_function,
+                        const std::array<std::size_t, sizeof...(Containers)>& xi_sizes, Containers&... xi_containers) {
+        std::size_t base{}, i{};
+        const auto visit = [&](auto& xi_container) {
+            const std::size_t size{ xi_sizes[i++] },
+                              first{ std::max(xi_first, base) },
+                              last{ std::min(xi_last, base + size) };
+            if (first < last) {
+                const auto begin{ std::next(std::begin(xi_container), static_cast<std::ptrdiff_t>(first - base)) };
+                xi_function(begin, std::next(begin, static_cast<std::ptrdiff_t>(last - first)));
+            }
+            base += size;
+        };
+        (visit(xi_containers), ...);
+    }
+
+    // k sorted sequences sharing a single iterator type
+    template<class Iterator> class RangeSources {
+        // properties
+        private:
+            std::vector<std::pair<Iterator, Iterator>> m_ranges;
+
+        // API
+        public:
+            void add(const Iterator xi_begin, const Iterator xi_end) { m_ranges.emplace_back(xi_begin, xi_end); }
+
+            std::size_t size() const noexcept { return m_ranges.size(); }
+
+            // address of current element of a given sequence, and advance it (nullptr if sequence is exhausted)
+            auto next(const std::size_t i) {
+                auto& [begin, end] = m_ranges[i];
+                return (begin == end) ? nullptr : std::addressof(*begin++);
+            }
+    };
+
+    // k sorted sequences of different collection types (sequence is selected using a jump table)
+    template<class...Containers> class TupleSources {
+        using Pointer = std::add_pointer_t<std::remove_reference_t<decltype(*std::begin(std::declval<const std::tuple_element_t<0, std::tuple<Containers...>>&>()))>>;
+        using Ranges  = std::tuple<std::pair<decltype(std::begin(std::declval<const Containers&>())), decltype(std::end(std::declval<const Containers&>()))>...>;
+
+        // properties
+        private:
+            Ranges m_ranges;
+
+        // constructor
+        public:
+            explicit TupleSources(const Containers&... xi_containers) : m_ranges{ std::make_pair(std::begin(xi_containers), std::end(xi_containers))... } {}
+
+        // API
+        public:
+            static constexpr std::size_t size() noexcept { return sizeof...(Containers); }
+
+            // address of current element of a given sequence, and advance it (nullptr if sequence is exhausted)
+            Pointer next(const std::size_t i) {
+                return Table(std::index_sequence_for<Containers...>{})[i](m_ranges);
+            }
+
+        // internal helpers
+        private:
+            template<std::size_t I> static Pointer Next(Ranges& xio_ranges) {
+                auto& [begin, end] = std::get<I>(xio_ranges);
+                return (begin == end) ? nullptr : std::addressof(*begin++);
+            }
+
+            template<std::size_t...Is> static constexpr std::array<Pointer(*)(Ranges&), sizeof...(Is)> Table(std::index_sequence<Is...>) noexcept {
+                return { { &Next<Is>... } };
+            }
+    };
+
+    /**
+    * \brief stable k-way merge of sorted sequences using a loser tree (tournament tree).
+    *        each output element costs log2(k) comparisons, along a single leaf to root path.
+    *
+    * @param {Sources,    in}  sorted sequences (see 'RangeSources' and 'TupleSources')
+    * @param {Comparison, in}  binary comparison function
+    * @param {OutputIt,   in}  output iterator
+    * @param {Move,       in}  if true, elements are moved (rather then copied) to output
+    * @param {OutputIt,   out} output iterator past last written element
+    **/
+    template<bool Move, class Sources, class Comparison, class OutputIt>
+    OutputIt loser_tree_merge(Sources& xio_sources, Comparison&& xi_comparison, OutputIt xo_out) {
+        const std::size_t k{ xio_sources.size() };
+        if (k == 0) return xo_out;
+
+        using Pointer = decltype(xio_sources.next(0));
+        std::vector<Pointer> heads(k);
+        for (std::size_t i{}; i < k; ++i) heads[i] = xio_sources.next(i);
+
+        // does sequence 'a' win against sequence 'b' (exhausted sequences always lose, ties are won by the first sequence)
+        const auto beats = [&heads, &xi_comparison](const std::size_t a, const std::size_t b) {
+            if (heads[a] == nullptr) return false;
+            if (heads[b] == nullptr) return true;
+            if (xi_comparison(*heads[a], *heads[b])) return true;
+            if (xi_comparison(*heads[b], *heads[a])) return false;
+            return a < b;
+        };
+
+        // leaves are nodes [k, 2k), internal node n holds the loser of the match between its children
+        std::vector<std::size_t> losers(k), winners(2 * k);
+        for (std::size_t i{}; i < k; ++i) winners[k + i] = i;
+        for (std::size_t n{ k - 1 }; n > 0; --n) {
+            const std::size_t left{ winners[2 * n] },
+                              right{ winners[2 * n + 1] };
+            const bool leftWins{ beats(left, right) };
+            winners[n] = leftWins ? left : right;
+            losers[n]  = leftWins ? right : left;
+        }
+
+        // output winner, advance its sequence and replay its path to the root
+        std::size_t winner{ winners[1] };
+        while (heads[winner] != nullptr) {
+            if constexpr (Move) *xo_out = std::move(*heads[winner]);
+            else                *xo_out = *heads[winner];
+            ++xo_out;
+
+            heads[winner] = xio_sources.next(winner);
+            for (std::size_t n{ (k + winner) / 2 }; n > 0; n /= 2) {
+                if (beats(losers[n], winner)) std::swap(losers[n], winner);
+            }
+        }
+
+        return xo_out;
+    }
+}
+
+/**
+* predicate expressions - a small DSL for element predicates, i.e. - '_x > 3 && _x < 10'.
+* an expression is an ordinary unary predicate, but when it is used by 'count_if', 'all_of', 'any_of', 'none_of' or
+* 'replace_if' on a contiguous collection of 'float', 'int32_t' or 'uint8_t' it is evaluated as SIMD mask operations
+* (requires SSE2, otherwise (or for any other predicate/collection) the 'std' algorithm is used).
+*
+* example usage:
+*
+*   using namespace predicate;
+*   std::vector<float> a{ ... };
+*   std::array<float, 64> b{ ... };
+*   const std::size_t inside{ count_if(std::execution::seq, _x > 3.0f && _x < 10.0f, a, b) };
+*   replace_if(std::execution::seq, _x < 0.0f || _x != _x, 0.0f, a, b); // replace negatives and NaN's with zero
+*
+*   // an expression has the semantics of the usual arithmetic conversions, and is evaluated without SIMD when they differ
+*   // from a comparison of 'T' lanes, i.e. - signed elements compared with an unsigned constant are compared as unsigned:
+*   std::vector<std::int32_t> c{ -1, -2, 1, 2, -5, 7, 8, 9 };
+*   assert(count_if(std::execution::seq, _x < 5u, c) == 2);    // as 'std::count_if(c.begin(), c.end(), _x < 5u)'
+*   assert(count_if(std::execution::seq, _x < 5, c) == 5);
+*   std::vector<std::uint8_t> d{ 0, 200, 255 };
+*   assert(count_if(std::execution::seq, _x > std::int8_t{ -1 }, d) == 3);  // compared with -1, not with 255
+**/
+namespace predicate {
+
+    // comparison operations
+    struct Less         { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a < b;  } };
+    struct LessEqual    { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a <= b; } };
+    struct Greater      { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a > b;  } };
+    struct GreaterEqual { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a >= b; } };
+    struct Equal        { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a == b; } };
+    struct NotEqual     { template<class A, class B> static constexpr bool apply(const A& a, const B& b) { return a != b; } };
+}
+
+namespace ExpandStlDetail {
+
+    // element type of a collection
+    template<class Container> using element_t = std::decay_t<decltype(*std::begin(std::declval<const Container&>()))>;
+
+    // test if a collection stores its elements contiguously
+    template<class Container, typename = void> struct is_contiguous : std::false_type {};
+    template<class Container>                  struct is_contiguous<Container, std::void_t<decltype(std::data(std::declval<const Container&>())),
+                                                                                           decltype(std::size(std::declval<const Container&>()))>> :
+                                                                                           std::is_pointer<decltype(std::data(std::declval<const Container&>()))> {};
+    template<class Container> inline constexpr bool is_contiguous_v = is_contiguous<Container>::value;
+
+    // test if predicate expressions over a given type are evaluated using SIMD instructions
+    template<typename T> inline constexpr bool is_simd_type_v = std::is_same_v<T, float> || std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint8_t>;
+
+    // does comparing 'T' lanes with a constant of type 'C' (converted to 'T') give the same result as the usual arithmetic
+    // conversions, i.e. - every 'T' value keeps its value when converted to the common type of 'T' and 'C'
+    // ('int32_t' elements compared with an unsigned constant are compared as unsigned, and 'int32_t' elements compared
+    // with a 'float' constant are rounded to 'float', so neither is evaluated using 'T' lanes)
+    template<typename T, typename C, typename U = std::common_type_t<T, C>>
+    inline constexpr bool is_lowered_exactly_v = std::is_floating_point_v<U> ? (std::numeric_limits<U>::digits >= std::numeric_limits<T>::digits) :
+                                                                                (std::is_unsigned_v<T> || std::is_signed_v<U>);
+    static_assert(is_lowered_exactly_v<std::int32_t, int> && is_lowered_exactly_v<std::int32_t, double> && is_lowered_exactly_v<std::uint8_t, int> &&
+                  is_lowered_exactly_v<float, double> && is_lowered_exactly_v<float, int>);
+    static_assert(!is_lowered_exactly_v<std::int32_t, unsigned> && !is_lowered_exactly_v<std::int32_t, std::uint64_t> && !is_lowered_exactly_v<std::int32_t, float>);
+
+    inline unsigned popcount(unsigned xi_value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcount(xi_value));
+#else
+        unsigned count{};
+        for (; xi_value != 0; xi_value &= xi_value - 1) ++count;
+        return count;
+#endif
+    }
+
+#ifdef EXPAND_STL_SIMD
+    /**
+    * SIMD lanes of a given element type.
+    * comparisons return a mask (all bits of a lane are set if comparison is true) as '__m128i'.
+    **/
+    template<typename T> struct SimdLanes;
+
+    template<> struct SimdLanes<float> {
+        using Vector = __m128;
+        static constexpr std::size_t Count{ 4 };
+        static constexpr unsigned All{ 0xF };
+
+        static Vector load(const float* xi_data) noexcept { return _mm_loadu_ps(xi_data); }
+        static void store(float* xo_data, const Vector xi_value) noexcept { _mm_storeu_ps(xo_data, xi_value); }
+        static Vector set1(const float xi_value) noexcept { return _mm_set1_ps(xi_value); }
+        static unsigned movemask(const __m128i xi_mask) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(xi_mask))); }
+        static Vector blend(const __m128i xi_mask, const Vector xi_true, const Vector xi_false) noexcept {
+            const __m128 mask{ _mm_castsi128_ps(xi_mask) };
+            return _mm_or_ps(_mm_and_ps(mask, xi_true), _mm_andnot_ps(mask, xi_false));
+        }
+
+        static __m128i compare(predicate::Less,         const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmplt_ps(a, b));  }
+        static __m128i compare(predicate::LessEqual,    const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmple_ps(a, b));  }
+        static __m128i compare(predicate::Greater,      const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmpgt_ps(a, b));  }
+        static __m128i compare(predicate::GreaterEqual, const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmpge_ps(a, b));  }
+        static __m128i compare(predicate::Equal,        const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmpeq_ps(a, b));  }
+        static __m128i compare(predicate::NotEqual,     const Vector a, const Vector b) noexcept { return _mm_castps_si128(_mm_cmpneq_ps(a, b)); }
+    };
+
+    template<> struct SimdLanes<std::int32_t> {
+        using Vector = __m128i;
+        static constexpr std::size_t Count{ 4 };
+        static constexpr unsigned All{ 0xF };
+
+        static Vector load(const std::int32_t* xi_data) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(xi_data)); }
+        static void store(std::int32_t* xo_data, const Vector xi_value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(xo_data), xi_value); }
+        static Vector set1(const std::int32_t xi_value) noexcept { return _mm_set1_epi32(xi_value); }
+        static unsigned movemask(const __m128i xi_mask) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(xi_mask))); }
+        static Vector blend(const __m128i xi_mask, const Vector xi_true, const Vector xi_false) noexcept {
+            return _mm_or_si128(_mm_and_si128(xi_mask, xi_true), _mm_andnot_si128(xi_mask, xi_false));
+        }
+
+        static __m128i compare(predicate::Less,         const Vector a, const Vector b) noexcept { return _mm_cmplt_epi32(a, b); }
+        static __m128i compare(predicate::LessEqual,    const Vector a, const Vector b) noexcept { return _mm_xor_si128(_mm_cmpgt_epi32(a, b), _mm_set1_epi32(-1)); }
+        static __m128i compare(predicate::Greater,      const Vector a, const Vector b) noexcept { return _mm_cmpgt_epi32(a, b); }
+        static __m128i compare(predicate::GreaterEqual, const Vector a, const Vector b) noexcept { return _mm_xor_si128(_mm_cmplt_epi32(a, b), _mm_set1_epi32(-1)); }
+        static __m128i compare(predicate::Equal,        const Vector a, const Vector b) noexcept { return _mm_cmpeq_epi32(a, b); }
+        static __m128i compare(predicate::NotEqual,     const Vector a, const Vector b) noexcept { return _mm_xor_si128(_mm_cmpeq_epi32(a, b), _mm_set1_epi32(-1)); }
+    };
+
+    // (SSE2 has no unsigned byte comparison, it is done using unsigned min/max)
+    template<> struct SimdLanes<std::uint8_t> {
+        using Vector = __m128i;
+        static constexpr std::size_t Count{ 16 };
+        static constexpr unsigned All{ 0xFFFF };
+
+        static Vector load(const std::uint8_t* xi_data) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(xi_data)); }
+        static void store(std::uint8_t* xo_data, const Vector xi_value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(xo_data), xi_value); }
+        static Vector set1(const std::uint8_t xi_value) noexcept { return _mm_set1_epi8(static_cast<char>(xi_value)); }
+        static unsigned movemask(const __m128i xi_mask) noexcept { return static_cast<unsigned>(_mm_movemask_epi8(xi_mask)); }
+        static Vector blend(const __m128i xi_mask, const Vector xi_true, const Vector xi_false) noexcept {
+            return _mm_or_si128(_mm_and_si128(xi_mask, xi_true), _mm_andnot_si128(xi_mask, xi_false));
+        }
+
+        static __m128i compare(predicate::Less,         const Vector a, const Vector b) noexcept { return _mm_xor_si128(compare(predicate::GreaterEqual{}, a, b), _mm_set1_epi8(-1)); }
+        static __m128i compare(predicate::LessEqual,    const Vector a, const Vector b) noexcept { return _mm_cmpeq_epi8(_mm_min_epu8(a, b), a); }
+        static __m128i compare(predicate::Greater,      const Vector a, const Vector b) noexcept { return _mm_xor_si128(compare(predicate::LessEqual{}, a, b), _mm_set1_epi8(-1)); }
+        static __m128i compare(predicate::GreaterEqual, const Vector a, const Vector b) noexcept { return _mm_cmpeq_epi8(_mm_max_epu8(a, b), a); }
+        static __m128i compare(predicate::Equal,        const Vector a, const Vector b) noexcept { return _mm_cmpeq_epi8(a, b); }
+        static __m128i compare(predicate::NotEqual,     const Vector a, const Vector b) noexcept { return _mm_xor_si128(_mm_cmpeq_epi8(a, b), _mm_set1_epi8(-1)); }
+    };
+#endif
+}
+
+namespace predicate {
+
+    // test if an object is a predicate expression
+    template<class T> struct is_expression : std::false_type {};
+    template<class T> inline constexpr bool is_expression_v = is_expression<std::decay_t<T>>::value;
+
+    // element compared to a constant
+    template<class Operation, class C> struct Compare {
+        C value;
+
+        template<class T> constexpr bool operator()(const T& xi_element) const { return Operation::apply(xi_element, value); }
+
+        // is the constant exactly representable as a 'T', and is comparing 'T' lanes identical to the usual arithmetic
+        // conversions (otherwise expression can not be evaluated using 'T' lanes)
+        // (the round trip is compared in the common type, so a 'int8_t' -1 is not lowered to a 'uint8_t' 255)
+        template<class T> constexpr bool representable() const noexcept {
+            if constexpr (!ExpandStlDetail::is_lowered_exactly_v<T, C>) return false;
+            if constexpr (std::is_floating_point_v<C> && std::is_integral_v<T>) {
+                if (!(value >= static_cast<C>(std::numeric_limits<T>::min()) && value <= static_cast<C>(std::numeric_limits<T>::max()))) return false;
+            }
+            using U = std::common_type_t<T, C>;
+            return static_cast<U>(static_cast<T>(value)) == static_cast<U>(value);
+        }
+
+#ifdef EXPAND_STL_SIMD
+        template<class T> __m128i mask(const typename ExpandStlDetail::SimdLanes<T>::Vector& xi_elements) const noexcept {
+            using Lanes = ExpandStlDetail::SimdLanes<T>;
+            return Lanes::compare(Operation{}, xi_elements, Lanes::set1(static_cast<T>(value)));
+        }
+#endif
+    };
+
+    // logical conjunction of two expressions
+    template<class L, class R> struct And {
+        L left;
+        R right;
+
+        template<class T> constexpr bool operator()(const T& xi_element) const { return left(xi_element) && right(xi_element); }
+        template<class T> bool representable() const noexcept { return left.template representable<T>() && right.template representable<T>(); }
+#ifdef EXPAND_STL_SIMD
+        template<class T> __m128i mask(const typename ExpandStlDetail::SimdLanes<T>::Vector& xi_elements) const noexcept {
+            return _mm_and_si128(left.template mask<T>(xi_elements), right.template mask<T>(xi_elements));
+        }
+#endif
+    };
+
+    // logical disjunction of two expressions
+    template<class L, class R> struct Or {
+        L left;
+        R right;
+
+        template<class T> constexpr bool operator()(const T& xi_element) const { return left(xi_element) || right(xi_element); }
+        template<class T> bool representable() const noexcept { return left.template representable<T>() && right.template representable<T>(); }
+#ifdef EXPAND_STL_SIMD
+        template<class T> __m128i mask(const typename ExpandStlDetail::SimdLanes<T>::Vector& xi_elements) const noexcept {
+            return _mm_or_si128(left.template mask<T>(xi_elements), right.template mask<T>(xi_elements));
+        }
+#endif
+    };
+
+    // logical negation of an expression
+    template<class E> struct Not {
+        E expression;
+
+        template<class T> constexpr bool operator()(const T& xi_element) const { return !expression(xi_element); }
+        template<class T> bool representable() const noexcept { return expression.template representable<T>(); }
+#ifdef EXPAND_STL_SIMD
+        template<class T> __m128i mask(const typename ExpandStlDetail::SimdLanes<T>::Vector& xi_elements) const noexcept {
+            return _mm_xor_si128(expression.template mask<T>(xi_elements), _mm_set1_epi32(-1));
+        }
+#endif
+    };
+
+    template<class Operation, class C> struct is_expression<Compare<Operation, C>> : std::true_type {};
+    template<class L, class R>         struct is_expression<And<L, R>>             : std::true_type {};
+    template<class L, class R>         struct is_expression<Or<L, R>>              : std::true_type {};
+    template<class E>                  struct is_expression<Not<E>>                : std::true_type {};
+
+    // the element placeholder
+    struct Placeholder {};
+    inline constexpr Placeholder _x{};
+
+    // '_x (op) constant' and 'constant (op) _x'
+#define M_PREDICATE_COMPARISON(OP, OPERATION, REVERSED)                                                                                         \
+    template<class C, typename std::enable_if<std::is_arithmetic_v<C>>::type* = nullptr>                                                         \
+    constexpr Compare<OPERATION, C> operator OP (Placeholder, const C xi_value) noexcept { return { xi_value }; }                                \
+    template<class C, typename std::enable_if<std::is_arithmetic_v<C>>::type* = nullptr>                                                         \
+    constexpr Compare<REVERSED, C> operator OP (const C xi_value, Placeholder) noexcept { return { xi_value }; }
+
+    M_PREDICATE_COMPARISON(<,  Less,         Greater);
+    M_PREDICATE_COMPARISON(<=, LessEqual,    GreaterEqual);
+    M_PREDICATE_COMPARISON(>,  Greater,      Less);
+    M_PREDICATE_COMPARISON(>=, GreaterEqual, LessEqual);
+    M_PREDICATE_COMPARISON(==, Equal,        Equal);
+    M_PREDICATE_COMPARISON(!=, NotEqual,     NotEqual);
+
+#undef M_PREDICATE_COMPARISON
+
+    // constants which are (not) evaluated using SIMD lanes
+    static_assert((_x > 5).template representable<std::uint8_t>() && (_x < 5).template representable<std::int32_t>() && (_x < 0.5).template representable<float>());
+    static_assert(!(_x > std::int8_t{ -1 }).template representable<std::uint8_t>() && !(_x > static_cast<std::int8_t>(-56)).template representable<std::uint8_t>() &&
+                  (std::is_unsigned_v<char> || !(_x == '\xC8').template representable<std::uint8_t>()) && !(_x > -1).template representable<std::uint8_t>() &&
+                  !(_x < 5u).template representable<std::int32_t>() && !(_x < 300).template representable<std::uint8_t>());
+
+    // '_x (op) _x' (only 'x != x' (NaN test) and 'x == x' are meaningful)
+    struct SelfEqual {
+        template<class T> constexpr bool operator()(const T& xi_element) const { return xi_element == xi_element; }
+        template<class T> bool representable() const noexcept { return true; }
+#ifdef EXPAND_STL_SIMD
+        template<class T> __m128i mask(const typename ExpandStlDetail::SimdLanes<T>::Vector& xi_elements) const noexcept {
+            return ExpandStlDetail::SimdLanes<T>::compare(Equal{}, xi_elements, xi_elements);
+        }
+#endif
+    };
+    template<> struct is_expression<SelfEqual> : std::true_type {};
+    constexpr SelfEqual operator==(Placeholder, Placeholder) noexcept { return {}; }
+    constexpr Not<SelfEqual> operator!=(Placeholder, Placeholder) noexcept { return { {} }; }
+
+    // expressions composition
+    template<class L, class R, typename std::enable_if<is_expression_v<L> && is_expression_v<R>>::type* = nullptr>
+    constexpr And<std::decay_t<L>, std::decay_t<R>> operator&&(L&& xi_left, R&& xi_right) noexcept { return { std::forward<L>(xi_left), std::forward<R>(xi_right) }; }
+
+    template<class L, class R, typename std::enable_if<is_expression_v<L> && is_expression_v<R>>::type* = nullptr>
+    constexpr Or<std::decay_t<L>, std::decay_t<R>> operator||(L&& xi_left, R&& xi_right) noexcept { return { std::forward<L>(xi_left), std::forward<R>(xi_right) }; }
+
+    template<class E, typename std::enable_if<is_expression_v<E>>::type* = nullptr>
+    constexpr Not<std::decay_t<E>> operator!(E&& xi_expression) noexcept { return { std::forward<E>(xi_expression) }; }
+}
+
+namespace ExpandStlDetail {
+
+    // is a predicate applied on a collection evaluated using SIMD kernels
+    template<class Container, class UnaryPredicate> constexpr bool is_simd_dispatchable() noexcept {
+#ifdef EXPAND_STL_SIMD
+        if constexpr (predicate::is_expression_v<UnaryPredicate> && is_contiguous_v<Container>) return is_simd_type_v<element_t<Container>>;
+#endif
+        return false;
+    }
+
+    // split 'xi_count' elements evenly among tasks (according to execution policy), and apply a function on each [first, last) slice
+    template<class ExecutionPolicy, class Function> void for_each_slice(ExecutionPolicy&& xi_policy, const std::size_t xi_count, const std::size_t xi_tasks, Function&& xi_function) {
+        if (xi_tasks == 1) {
+            xi_function(std::size_t{}, std::size_t{}, xi_count);
+            return;
+        }
+
+        std::vector<std::size_t> ids(xi_tasks);
+        std::iota(ids.begin(), ids.end(), std::size_t{});
+        std::for_each(std::forward<ExecutionPolicy>(xi_policy), ids.begin(), ids.end(), [&](const std::size_t xi_task) {
+            xi_function(xi_task, xi_count * xi_task / xi_tasks, xi_count * (xi_task + 1) / xi_tasks);
+        });
+    }
+
+#ifdef EXPAND_STL_SIMD
+    // amount of elements (in [xi_data, xi_data + xi_count)) satisfying a predicate expression
+    template<class T, class Expression> std::size_t simd_count_if(const T* xi_data, const std::size_t xi_count, const Expression& xi_expression) noexcept {
+        using Lanes = SimdLanes<T>;
+        std::size_t count{}, i{};
+        for (; i + Lanes::Count <= xi_count; i += Lanes::Count) {
+            count += popcount(Lanes::movemask(xi_expression.template mask<T>(Lanes::load(xi_data + i))));
+        }
+        for (; i < xi_count; ++i) count += static_cast<std::size_t>(xi_expression(xi_data[i]));
+        return count;
+    }
+
+    // does any element (in [xi_data, xi_data + xi_count)) satisfy (or fail, if 'Fails' is true) a predicate expression
+    template<bool Fails, class T, class Expression> bool simd_any_of(const T* xi_data, const std::size_t xi_count, const Expression& xi_expression) noexcept {
+        using Lanes = SimdLanes<T>;
+        std::size_t i{};
+        for (; i + Lanes::Count <= xi_count; i += Lanes::Count) {
+            const unsigned mask{ Lanes::movemask(xi_expression.template mask<T>(Lanes::load(xi_data + i))) };
+            if (mask != (Fails ? Lanes::All : 0u)) return true;
+        }
+        for (; i < xi_count; ++i) {
+            if (xi_expression(xi_data[i]) != Fails) return true;
+        }
+        return false;
+    }
+
+    // replace elements (in [xo_data, xo_data + xi_count)) satisfying a predicate expression with a given value
+    template<class T, class Expression> void simd_replace_if(T* xo_data, const std::size_t xi_count, const Expression& xi_expression, const T xi_value) noexcept {
+        using Lanes = SimdLanes<T>;
+        const typename Lanes::Vector value{ Lanes::set1(xi_value) };
+        std::size_t i{};
+        for (; i + Lanes::Count <= xi_count; i += Lanes::Count) {
+            const typename Lanes::Vector elements{ Lanes::load(xo_data + i) };
+            Lanes::store(xo_data + i, Lanes::blend(xi_expression.template mask<T>(elements), value, elements));
+        }
+        for (; i < xi_count; ++i) {
+            if (xi_expression(xo_data[i])) xo_data[i] = xi_value;
+        }
+    }
+#endif
+
+    // 'std::count_if' on a single collection, using SIMD kernels if possible
+    template<class ExecutionPolicy, class UnaryPredicate, class Container>
+    std::size_t count_if_in(ExecutionPolicy&& xi_policy, const UnaryPredicate& xi_predicate, const Container& xi_container) {
+#ifdef EXPAND_STL_SIMD
+        if constexpr (is_simd_dispatchable<Container, UnaryPredicate>()) {
+            using T = element_t<Container>;
+            if (xi_predicate.template representable<T>()) {
+                const T* data{ std::data(xi_container) };
+                const std::size_t count{ std::size(xi_container) },
+                                  tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : task_count(count) };
+                std::vector<std::size_t> counts(tasks);
+                for_each_slice(std::forward<ExecutionPolicy>(xi_policy), count, tasks, [&](const std::size_t xi_task, const std::size_t xi_first, const std::size_t xi_last) {
+                    counts[xi_task] = simd_count_if(data + xi_first, xi_last - xi_first, xi_predicate);
+                });
+                return std::accumulate(counts.begin(), counts.end(), std::size_t{});
+            }
+        }
+#endif
+        return static_cast<std::size_t>(std::count_if(std::forward<ExecutionPolicy>(xi_policy), std::begin(xi_container), std::end(xi_container), xi_predicate));
+    }
+
+    // 'std::any_of' (or 'std::all_of' negation, if 'Fails' is true) on a single collection, using SIMD kernels if possible
+    template<bool Fails, class ExecutionPolicy, class UnaryPredicate, class Container>
+    bool any_of_in(ExecutionPolicy&& xi_policy, const UnaryPredicate& xi_predicate, const Container& xi_container) {
+#ifdef EXPAND_STL_SIMD
+        if constexpr (is_simd_dispatchable<Container, UnaryPredicate>()) {
+            using T = element_t<Container>;
+            if (xi_predicate.template representable<T>()) {
+                const T* data{ std::data(xi_container) };
+                const std::size_t count{ std::size(xi_container) },
+                                  tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : task_count(count) };
+                std::vector<char> found(tasks);
+                for_each_slice(std::forward<ExecutionPolicy>(xi_policy), count, tasks, [&](const std::size_t xi_task, const std::size_t xi_first, const std::size_t xi_last) {
+                    found[xi_task] = simd_any_of<Fails>(data + xi_first, xi_last - xi_first, xi_predicate);
+                });
+                return std::find(found.begin(), found.end(), char{ 1 }) != found.end();
+            }
+        }
+#endif
+        if constexpr (Fails) return !std::all_of(std::forward<ExecutionPolicy>(xi_policy), std::begin(xi_container), std::end(xi_container), xi_predicate);
+        else                 return std::any_of(std::forward<ExecutionPolicy>(xi_policy), std::begin(xi_container), std::end(xi_container), xi_predicate);
+    }
+
+    // 'std::replace_if' on a single collection, using SIMD kernels if possible
+    template<class ExecutionPolicy, class UnaryPredicate, class T, class Container>
+    void replace_if_in(ExecutionPolicy&& xi_policy, const UnaryPredicate& xi_predicate, const T& xi_value, Container& xi_container) {
+#ifdef EXPAND_STL_SIMD
+        if constexpr (is_simd_dispatchable<Container, UnaryPredicate>()) {
+            using E = element_t<Container>;
+            if (xi_predicate.template representable<E>() && (static_cast<T>(static_cast<E>(xi_value)) == xi_value)) {
+                E* data{ std::data(xi_container) };
+                const std::size_t count{ std::size(xi_container) },
+                                  tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : task_count(count) };
+                for_each_slice(std::forward<ExecutionPolicy>(xi_policy), count, tasks, [&](const std::size_t, const std::size_t xi_first, const std::size_t xi_last) {
+                    simd_replace_if(data + xi_first, xi_last - xi_first, xi_predicate, static_cast<E>(xi_value));
+                });
+                return;
+            }
+        }
+#endif
+        std::replace_if(std::forward<ExecutionPolicy>(xi_policy), std::begin(xi_container), std::end(xi_container), xi_predicate, xi_value);
+    }
+
+    // test if a collection can erase a range of elements
+    template<class Container, typename = void> struct is_range_erasable : std::false_type {};
+    template<class Container>                  struct is_range_erasable<Container, std::void_t<decltype(std::declval<Container&>().erase(std::begin(std::declval<Container&>()),
+                                                                                                                                        std::end(std::declval<Container&>())))>> : std::true_type {};
+
+#ifdef EXPAND_STL_SIMD
+    /**
+    * \brief in place removal of elements (in [xio_data, xio_data + xi_count)) satisfying a predicate expression.
+    *        each block is tested using SIMD, and its kept lanes are written (branch free) at the running kept position.
+    *
+    * @param {T*,         in|out} elements
+    * @param {size_t,     in}     amount of elements
+    * @param {Expression, in}     predicate expression
+    * @param {size_t,     out}    amount of kept elements
+    **/
+    template<class T, class Expression> std::size_t simd_remove_if(T* xio_data, const std::size_t xi_count, const Expression& xi_expression) noexcept {
+        using Lanes = SimdLanes<T>;
+        T lanes[Lanes::Count];
+        std::size_t kept{}, i{};
+        for (; i + Lanes::Count <= xi_count; i += Lanes::Count) {
+            const typename Lanes::Vector elements{ Lanes::load(xio_data + i) };
+            const unsigned keep{ ~Lanes::movemask(xi_expression.template mask<T>(elements)) & Lanes::All };
+
+            if (keep == Lanes::All) {
+                Lanes::store(xio_data + kept, elements);
+                kept += Lanes::Count;
+            }
+            else if (keep != 0) {
+                Lanes::store(lanes, elements);
+                for (std::size_t j{}; j < Lanes::Count; ++j) {
+                    xio_data[kept] = lanes[j];
+                    kept += (keep >> j) & 1u;
+                }
+            }
+        }
+        for (; i < xi_count; ++i) {
+            const T element{ xio_data[i] };
+            xio_data[kept] = element;
+            kept += static_cast<std::size_t>(!xi_expression(element));
+        }
+        return kept;
+    }
+#endif
+
+    /**
+    * \brief parallel in place compaction of a random access range.
+    *        range is split into 'xi_tasks' slices, each slice is compacted (in parallel) by 'xi_compact', the final
+    *        offset of each slice kept elements is the prefix sum of kept counts, and kept elements are moved (in
+    *        parallel) to their final offsets through a scratch buffer (a slice destination may overlap kept elements
+    *        of its previous slice, so slices can not be moved in place concurrently).
+    *
+    * @param {ExecutionPolicy, in}  execution policy
+    * @param {Iterator,        in}  range begin
+    * @param {Iterator,        in}  range end
+    * @param {size_t,          in}  amount of slices
+    * @param {Compact,         in}  'pair<Iterator, Iterator> (Iterator first, Iterator last, size_t slice)' - compact a slice and return its kept range
+    * @param {Iterator,        out} end of kept elements
+    **/
+    template<class ExecutionPolicy, class Iterator, class Compact>
+    Iterator parallel_compact(ExecutionPolicy&& xi_policy, const Iterator xi_begin, const Iterator xi_end, const std::size_t xi_tasks, Compact&& xi_compact) {
+        const std::size_t count{ static_cast<std::size_t>(xi_end - xi_begin) };
+        std::vector<std::pair<Iterator, Iterator>> kept(xi_tasks);
+        for_each_slice(xi_policy, count, xi_tasks, [&](const std::size_t xi_task, const std::size_t xi_first, const std::size_t xi_last) {
+            kept[xi_task] = xi_compact(xi_begin + static_cast<std::ptrdiff_t>(xi_first), xi_begin + static_cast<std::ptrdiff_t>(xi_last), xi_task);
+        });
+
+        // final offset of each slice kept elements
+        std::vector<std::size_t> offset(xi_tasks + 1);
+        for (std::size_t t{}; t < xi_tasks; ++t) offset[t + 1] = offset[t] + static_cast<std::size_t>(kept[t].second - kept[t].first);
+
+        // leading slices which are already at their final offset are not moved
+        std::size_t first{};
+        while ((first < xi_tasks) && (kept[first].first == xi_begin + static_cast<std::ptrdiff_t>(offset[first]))) ++first;
+        if (first == xi_tasks) return xi_begin + static_cast<std::ptrdiff_t>(offset[xi_tasks]);
+
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        std::allocator<T> allocator;
+        const std::size_t moved{ offset[xi_tasks] - offset[first] };
+        T* scratch{ allocator.allocate(moved) };
+
+        std::vector<std::size_t> ids(xi_tasks - first);
+        std::iota(ids.begin(), ids.end(), first);
+        std::for_each(xi_policy, ids.begin(), ids.end(), [&](const std::size_t xi_task) {
+            std::uninitialized_move(kept[xi_task].first, kept[xi_task].second, scratch + (offset[xi_task] - offset[first]));
+        });
+        std::for_each(std::forward<ExecutionPolicy>(xi_policy), ids.begin(), ids.end(), [&](const std::size_t xi_task) {
+            T* const slice{ scratch + (offset[xi_task] - offset[first]) };
+            const std::size_t size{ offset[xi_task + 1] - offset[xi_task] };
+            std::move(slice, slice + size, xi_begin + static_cast<std::ptrdiff_t>(offset[xi_task]));
+            std::destroy(slice, slice + size);
+        });
+
+        allocator.deallocate(scratch, moved);
+        return xi_begin + static_cast<std::ptrdiff_t>(offset[xi_tasks]);
+    }
+
+    // 'std::remove_if' followed by 'erase' (if collection supports it) on a single collection, return new size
+    template<class ExecutionPolicy, class UnaryPredicate, class Container>
+    std::size_t remove_if_in(ExecutionPolicy&& xi_policy, const UnaryPredicate& xi_predicate, Container& xi_container) {
+        using Iterator = decltype(std::begin(xi_container));
+        const Iterator begin{ std::begin(xi_container) },
+                       end{ std::end(xi_container) };
+
+        Iterator last;
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>) {
+            const std::size_t count{ static_cast<std::size_t>(end - begin) },
+                              tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : task_count(count) };
+            last = parallel_compact(std::forward<ExecutionPolicy>(xi_policy), begin, end, tasks, [&](const Iterator xi_first, const Iterator xi_last, const std::size_t) {
+#ifdef EXPAND_STL_SIMD
+                if constexpr (is_simd_dispatchable<Container, UnaryPredicate>()) {
+                    if (xi_predicate.template representable<element_t<Container>>()) {
+                        const std::size_t kept{ simd_remove_if(std::data(xi_container) + (xi_first - begin), static_cast<std::size_t>(xi_last - xi_first), xi_predicate) };
+                        return std::make_pair(xi_first, xi_first + static_cast<std::ptrdiff_t>(kept));
+                    }
+                }
+#endif
+                return std::make_pair(xi_first, std::remove_if(xi_first, xi_last, xi_predicate));
+            });
+        }
+        else {
+            last = std::remove_if(begin, end, xi_predicate);
+        }
+
+        const std::size_t size{ static_cast<std::size_t>(std::distance(begin, last)) };
+        if constexpr (is_range_erasable<Container>::value) xi_container.erase(last, end);
+        return size;
+    }
+
+    // 'std::unique' followed by 'erase' (if collection supports it) on a single collection, return new size
+    template<class ExecutionPolicy, class BinaryPredicate, class Container>
+    std::size_t unique_in(ExecutionPolicy&& xi_policy, const BinaryPredicate& xi_predicate, Container& xi_container) {
+        using Iterator = decltype(std::begin(xi_container));
+        const Iterator begin{ std::begin(xi_container) },
+                       end{ std::end(xi_container) };
+
+        Iterator last;
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>) {
+            const std::size_t count{ static_cast<std::size_t>(end - begin) },
+                              tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : task_count(count) };
+
+            // is the first element of a slice equivalent to the last element of its previous slice (tested before any slice is modified)
+            std::vector<char> duplicate(tasks);
+            for (std::size_t t{ 1 }; t < tasks; ++t) {
+                const Iterator first{ begin + static_cast<std::ptrdiff_t>(count * t / tasks) };
+                duplicate[t] = static_cast<char>(xi_predicate(*std::prev(first), *first));
+            }
+
+            last = parallel_compact(std::forward<ExecutionPolicy>(xi_policy), begin, end, tasks, [&](const Iterator xi_first, const Iterator xi_last, const std::size_t xi_task) {
+                const Iterator kept{ std::unique(xi_first, xi_last, xi_predicate) };
+                return std::make_pair((duplicate[xi_task] && (xi_first != kept)) ? std::next(xi_first) : xi_first, kept);
+            });
+        }
+        else {
+            last = std::unique(begin, end, xi_predicate);
+        }
+
+        const std::size_t size{ static_cast<std::size_t>(std::distance(begin, last)) };
+        if constexpr (is_range_erasable<Container>::value) xi_container.erase(last, end);
+        return size;
+    }
 }
 
 /**
@@ -42,13 +775,48 @@ namespace {
 *                               or
 *                               parameter pack of T objects
 * @param {double,          out} reduced output
+*
+* remarks: collections are reduced as a single concatenated sequence, i.e. - 'xi_init' is used once, and a parallel
+*          execution policy splits the sequence evenly among hardware threads regardless of collections boundaries.
+*          partial reductions are combined in a (left to right) tree, so operation should be associative.
 **/
 template<class ExecutionPolicy, class T, class BinaryOp, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline T reduce(ExecutionPolicy&& xi_policy, const T xi_init, BinaryOp&& xi_operation, const Containers&... xi_containers) {
-    const auto reduced_containers = std::initializer_list<T>{
-        std::reduce(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), xi_init, std::forward<BinaryOp>(xi_operation))...
-    };
-    return std::reduce(std::forward<ExecutionPolicy>(xi_policy), reduced_containers.begin(), reduced_containers.end(), xi_init, std::forward<BinaryOp>(xi_operation));
+    const auto sizes = ExpandStlDetail::sizes(xi_containers...);
+    std::size_t count{};
+    for (const std::size_t size : sizes) count += size;
+
+    const std::size_t tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : ExpandStlDetail::task_count(count) };
+    if ((count == 0) || (tasks == 1)) {
+        T reduced{ xi_init };
+        ExpandStlDetail::for_each_range(0, count, [&reduced, &xi_operation](const auto xi_begin, const auto xi_end) {
+            reduced = std::reduce(xi_begin, xi_end, reduced, xi_operation);
+        }, sizes, xi_containers...);
+        return reduced;
+    }
+
+    // each task reduces its own (non empty) slice, starting with its first element
+    std::vector<std::optional<T>> partials(tasks);
+    std::vector<std::size_t> ids(tasks);
+    std::iota(ids.begin(), ids.end(), std::size_t{});
+    std::for_each(std::forward<ExecutionPolicy>(xi_policy), ids.begin(), ids.end(), [&](const std::size_t xi_task) {
+        const std::size_t first{ count * xi_task / tasks },
+                          last{ count * (xi_task + 1) / tasks };
+        std::optional<T>& partial{ partials[xi_task] };
+        ExpandStlDetail::for_each_range(first, last, [&partial, &xi_operation](const auto xi_begin, const auto xi_end) {
+            if (partial.has_value()) partial = std::reduce(xi_begin, xi_end, *partial, xi_operation);
+            else                     partial = std::reduce(std::next(xi_begin), xi_end, static_cast<T>(*xi_begin), xi_operation);
+        }, sizes, xi_containers...);
+    });
+
+    // combine partials in a tree
+    for (std::size_t stride{ 1 }; stride < tasks; stride *= 2) {
+        for (std::size_t i{}; i + stride < tasks; i += 2 * stride) {
+            partials[i] = xi_operation(*partials[i], *partials[i + stride]);
+        }
+    }
+
+    return xi_operation(xi_init, *partials[0]);
 }
 
 template<class T, class BinaryOp, class...Containers, typename std::enable_if<are_homogeneous_pack<Containers...>>::type* = nullptr>
@@ -69,7 +837,7 @@ constexpr inline T reduce(const T xi_init, BinaryOp&& xi_operation, const Contai
 **/
 template<class ExecutionPolicy, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline bool all_of(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, const Containers&... xi_containers) {
-    return (std::all_of(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate)) && ...);
+    return (!ExpandStlDetail::any_of_in<true>(xi_policy, xi_predicate, xi_containers) && ...);
 }
 
 template<class UnaryPredicate, class... Containers, typename std::enable_if<are_homogeneous_pack<Containers...>>::type* = nullptr>
@@ -90,7 +858,7 @@ constexpr inline bool all_of(UnaryPredicate&& xi_predicate, const Containers&...
 **/
 template<class ExecutionPolicy, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline bool any_of(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, const Containers&... xi_containers) {
-    return (std::any_of(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate)) || ...);
+    return (ExpandStlDetail::any_of_in<false>(xi_policy, xi_predicate, xi_containers) || ...);
 }
 
 template<class UnaryPredicate, class... Containers, typename std::enable_if<are_homogeneous_pack<Containers...>>::type* = nullptr>
@@ -111,7 +879,7 @@ constexpr inline bool any_of(UnaryPredicate&& xi_predicate, const Containers&...
 **/
 template<class ExecutionPolicy, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline bool none_of(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, const Containers&... xi_containers) {
-    return (std::none_of(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate)) && ...);
+    return (!ExpandStlDetail::any_of_in<false>(xi_policy, xi_predicate, xi_containers) && ...);
 }
 
 template<class UnaryPredicate, class...Containers, typename std::enable_if<are_homogeneous_pack<Containers...>>::type* = nullptr>
@@ -134,7 +902,7 @@ constexpr inline bool none_of(UnaryPredicate&& xi_predicate, const Containers&..
 **/
 template<class ExecutionPolicy, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline std::size_t count_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, const Containers&... xi_containers) {
-    return (std::count_if(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate)) + ...);
+    return (ExpandStlDetail::count_if_in(xi_policy, xi_predicate, xi_containers) + ...);
 }
 
 template<class UnaryPredicate, class...Containers, typename std::enable_if<are_homogeneous_pack<Containers...>>::type* = nullptr>
@@ -187,10 +955,16 @@ constexpr inline void fill(ExecutionPolicy&& xi_policy, const T xi_value, Contai
 * @param {UnaryPredicate , in}  unary predicate
 * @param {collections,     in}  collections on which the removal operation shall be performed.
 *                               collection should be iterate-able and with "same" underlying type.
+* @param {array,           out} new size of each collection
+*
+* remarks: removed elements are erased from collections which support range 'erase' (otherwise, i.e. - 'std::array',
+*          elements past the new size are left in a valid but unspecified state).
+*          random access collections are compacted in parallel (according to execution policy), and contiguous
+*          collections of float/int32_t/uint8_t are compacted using SIMD kernels if predicate is a predicate expression.
 **/
 template<class ExecutionPolicy, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
-constexpr inline void remove_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, Containers&... xi_containers) {
-    ((void)std::remove_if(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate)), ...);
+inline std::array<std::size_t, sizeof...(Containers)> remove_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, Containers&... xi_containers) {
+    return { { ExpandStlDetail::remove_if_in(xi_policy, xi_predicate, xi_containers)... } };
 }
 
 /**
@@ -205,7 +979,7 @@ constexpr inline void remove_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi
 **/
 template<class ExecutionPolicy, class T, class UnaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
 constexpr inline void replace_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& xi_predicate, const T xi_value, Containers&... xi_containers) {
-    (std::replace_if(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<UnaryPredicate>(xi_predicate), xi_value), ...);
+    (ExpandStlDetail::replace_if_in(xi_policy, xi_predicate, xi_value, xi_containers), ...);
 }
 
 /**
@@ -216,10 +990,14 @@ constexpr inline void replace_if(ExecutionPolicy&& xi_policy, UnaryPredicate&& x
 * @param {BinaryPredicate, in}  binary predicate
 * @param {collections,     in}  collections on which the 'unique' operation shall be performed.
 *                               collection should be iterate-able and with "same" underlying type.
+* @param {array,           out} new size of each collection
+*
+* remarks: removed elements are erased from collections which support range 'erase'.
+*          random access collections are compacted in parallel (according to execution policy).
 **/
 template<class ExecutionPolicy, class BinaryPredicate, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
-constexpr inline void unique(ExecutionPolicy&& xi_policy, BinaryPredicate&& xi_predicate, Containers&... xi_containers) {
-    ((void)std::unique(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<BinaryPredicate>(xi_predicate)), ...);
+inline std::array<std::size_t, sizeof...(Containers)> unique(ExecutionPolicy&& xi_policy, BinaryPredicate&& xi_predicate, Containers&... xi_containers) {
+    return { { ExpandStlDetail::unique_in(xi_policy, xi_predicate, xi_containers)... } };
 }
 
 /**
@@ -250,3 +1028,305 @@ template<class ExecutionPolicy, class Comparison, class...Containers, typename s
 constexpr inline void sort(ExecutionPolicy&& xi_policy, Comparison&& xi_comparison, Containers&... xi_containers) {
     return (std::sort(std::forward<ExecutionPolicy>(xi_policy), xi_containers.begin(), xi_containers.end(), std::forward<Comparison>(xi_comparison)), ...);
 }
+
+/**
+* aggregations which can be evaluated together, in a single traversal, using 'fused'.
+* an aggregation is an object with the following (const) methods:
+*   template<class T> S state()      - initial (per task) state, given collections underlying type 'T'
+*   void accumulate(S&, const T&)    - add an element to a state
+*   void combine(S&, S&&)            - merge a (following) state into a state
+*   R result(S&&)                    - final result
+**/
+namespace aggregate {
+
+    // number of elements which return 'true' for a given predicate
+    template<class UnaryPredicate> struct count_if_t {
+        UnaryPredicate predicate;
+
+        template<class T> std::size_t state() const { return 0; }
+        template<class T> void accumulate(std::size_t& xio_state, const T& xi_element) const { xio_state += static_cast<std::size_t>(static_cast<bool>(predicate(xi_element))); }
+        void combine(std::size_t& xio_state, const std::size_t xi_other) const { xio_state += xi_other; }
+        std::size_t result(const std::size_t xi_state) const { return xi_state; }
+    };
+    template<class UnaryPredicate> constexpr count_if_t<std::decay_t<UnaryPredicate>> count_if(UnaryPredicate&& xi_predicate) { return { std::forward<UnaryPredicate>(xi_predicate) }; }
+
+    // is a given predicate 'true' for all elements
+    template<class UnaryPredicate> struct all_of_t {
+        UnaryPredicate predicate;
+
+        template<class T> bool state() const { return true; }
+        template<class T> void accumulate(bool& xio_state, const T& xi_element) const { xio_state &= static_cast<bool>(predicate(xi_element)); }
+        void combine(bool& xio_state, const bool xi_other) const { xio_state &= xi_other; }
+        bool result(const bool xi_state) const { return xi_state; }
+    };
+    template<class UnaryPredicate> constexpr all_of_t<std::decay_t<UnaryPredicate>> all_of(UnaryPredicate&& xi_predicate) { return { std::forward<UnaryPredicate>(xi_predicate) }; }
+
+    // is a given predicate 'true' for at least one element
+    template<class UnaryPredicate> struct any_of_t {
+        UnaryPredicate predicate;
+
+        template<class T> bool state() const { return false; }
+        template<class T> void accumulate(bool& xio_state, const T& xi_element) const { xio_state |= static_cast<bool>(predicate(xi_element)); }
+        void combine(bool& xio_state, const bool xi_other) const { xio_state |= xi_other; }
+        bool result(const bool xi_state) const { return xi_state; }
+    };
+    template<class UnaryPredicate> constexpr any_of_t<std::decay_t<UnaryPredicate>> any_of(UnaryPredicate&& xi_predicate) { return { std::forward<UnaryPredicate>(xi_predicate) }; }
+
+    // is a given predicate 'true' for no element
+    template<class UnaryPredicate> struct none_of_t : any_of_t<UnaryPredicate> {
+        bool result(const bool xi_state) const { return !xi_state; }
+    };
+    template<class UnaryPredicate> constexpr none_of_t<std::decay_t<UnaryPredicate>> none_of(UnaryPredicate&& xi_predicate) { return { { std::forward<UnaryPredicate>(xi_predicate) } }; }
+
+    // binary reduction ('init' is used once, operation should be associative)
+    template<class T, class BinaryOp> struct reduce_t {
+        T init;
+        BinaryOp operation;
+
+        template<class U> std::optional<T> state() const { return std::nullopt; }
+        template<class U> void accumulate(std::optional<T>& xio_state, const U& xi_element) const {
+            if (xio_state.has_value()) xio_state = operation(*xio_state, xi_element);
+            else                       xio_state.emplace(xi_element);
+        }
+        void combine(std::optional<T>& xio_state, std::optional<T>&& xi_other) const {
+            if (!xi_other.has_value()) return;
+            if (xio_state.has_value()) xio_state = operation(*xio_state, *xi_other);
+            else                       xio_state = std::move(xi_other);
+        }
+        T result(std::optional<T>&& xi_state) const { return xi_state.has_value() ? operation(init, *xi_state) : init; }
+    };
+    template<class T, class BinaryOp> constexpr reduce_t<T, std::decay_t<BinaryOp>> reduce(const T xi_init, BinaryOp&& xi_operation) { return { xi_init, std::forward<BinaryOp>(xi_operation) }; }
+
+    // smallest element according to a given comparison (first one if several are equivalent, empty if there are no elements)
+    template<class Comparison> struct min_t {
+        Comparison comparison;
+
+        template<class T> std::optional<T> state() const { return std::nullopt; }
+        template<class T> void accumulate(std::optional<T>& xio_state, const T& xi_element) const {
+            if (!xio_state.has_value() || comparison(xi_element, *xio_state)) xio_state = xi_element;
+        }
+        template<class T> void combine(std::optional<T>& xio_state, std::optional<T>&& xi_other) const {
+            if (xi_other.has_value()) accumulate(xio_state, *xi_other);
+        }
+        template<class T> std::optional<T> result(std::optional<T>&& xi_state) const { return std::move(xi_state); }
+    };
+    template<class Comparison = std::less<>> constexpr min_t<std::decay_t<Comparison>> min(Comparison&& xi_comparison = {}) { return { std::forward<Comparison>(xi_comparison) }; }
+
+    // largest element according to a given comparison (first one if several are equivalent, empty if there are no elements)
+    template<class Comparison> struct max_t {
+        Comparison comparison;
+
+        template<class T> std::optional<T> state() const { return std::nullopt; }
+        template<class T> void accumulate(std::optional<T>& xio_state, const T& xi_element) const {
+            if (!xio_state.has_value() || comparison(*xio_state, xi_element)) xio_state = xi_element;
+        }
+        template<class T> void combine(std::optional<T>& xio_state, std::optional<T>&& xi_other) const {
+            if (xi_other.has_value()) accumulate(xio_state, *xi_other);
+        }
+        template<class T> std::optional<T> result(std::optional<T>&& xi_state) const { return std::move(xi_state); }
+    };
+    template<class Comparison = std::less<>> constexpr max_t<std::decay_t<Comparison>> max(Comparison&& xi_comparison = {}) { return { std::forward<Comparison>(xi_comparison) }; }
+}
+
+/**
+* variadic collections bound for a single pass (fused) evaluation of several aggregations.
+* do not use directly, use 'fused'.
+**/
+template<class ExecutionPolicy, class...Containers> class Fused {
+    using T = std::decay_t<decltype(*std::begin(std::declval<const std::tuple_element_t<0, std::tuple<Containers...>>&>()))>;
+
+    // properties
+    private:
+        ExecutionPolicy                  m_policy;
+        std::tuple<const Containers&...> m_containers;
+
+    // constructor
+    public:
+        constexpr Fused(ExecutionPolicy xi_policy, const Containers&... xi_containers) : m_policy(xi_policy), m_containers(xi_containers...) {}
+
+    // API
+    public:
+
+        /**
+        * \brief evaluate several aggregations (see namespace 'aggregate') in a single traversal of the collections.
+        *        a parallel execution policy splits the collections (as a single concatenated sequence) evenly among hardware threads.
+        *
+        * @param {aggregations, in}  aggregations
+        * @param {tuple,        out} aggregations results (in order)
+        **/
+        template<class...Aggregates> auto operator()(const Aggregates&... xi_aggregates) const {
+            using States = std::tuple<decltype(xi_aggregates.template state<T>())...>;
+            constexpr auto Indices{ std::index_sequence_for<Aggregates...>{} };
+
+            const auto sizes = std::apply([](const auto&... xi_containers) { return ExpandStlDetail::sizes(xi_containers...); }, m_containers);
+            std::size_t count{};
+            for (const std::size_t size : sizes) count += size;
+            const std::size_t tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : ExpandStlDetail::task_count(count) };
+
+            // each task accumulates its own slice (all aggregations per element)
+            std::vector<States> states(tasks, States{ xi_aggregates.template state<T>()... });
+            const auto task = [&](const std::size_t xi_task) {
+                States& state{ states[xi_task] };
+                const auto range = [&](auto xi_begin, const auto xi_end) {
+                    for (; xi_begin != xi_end; ++xi_begin) Accumulate(state, *xi_begin, Indices, xi_aggregates...);
+                };
+                std::apply([&](const auto&... xi_containers) {
+                    ExpandStlDetail::for_each_range(count * xi_task / tasks, count * (xi_task + 1) / tasks, range, sizes, xi_containers...);
+                }, m_containers);
+            };
+
+            if (tasks == 1) task(0);
+            else {
+                std::vector<std::size_t> ids(tasks);
+                std::iota(ids.begin(), ids.end(), std::size_t{});
+                std::for_each(m_policy, ids.begin(), ids.end(), task);
+
+                // combine states in a tree
+                for (std::size_t stride{ 1 }; stride < tasks; stride *= 2) {
+                    for (std::size_t i{}; i + stride < tasks; i += 2 * stride) {
+                        Combine(states[i], std::move(states[i + stride]), Indices, xi_aggregates...);
+                    }
+                }
+            }
+
+            return Result(std::move(states[0]), Indices, xi_aggregates...);
+        }
+
+    // internal helpers
+    private:
+        template<class States, class E, std::size_t...Is, class...Aggregates>
+        static void Accumulate(States& xio_states, const E& xi_element, std::index_sequence<Is...>, const Aggregates&... xi_aggregates) {
+            (xi_aggregates.accumulate(std::get<Is>(xio_states), xi_element), ...);
+        }
+
+        template<class States, std::size_t...Is, class...Aggregates>
+        static void Combine(States& xio_states, States&& xi_other, std::index_sequence<Is...>, const Aggregates&... xi_aggregates) {
+            (xi_aggregates.combine(std::get<Is>(xio_states), std::move(std::get<Is>(xi_other))), ...);
+        }
+
+        template<class States, std::size_t...Is, class...Aggregates>
+        static auto Result(States&& xi_states, std::index_sequence<Is...>, const Aggregates&... xi_aggregates) {
+            return std::make_tuple(xi_aggregates.result(std::move(std::get<Is>(xi_states)))...);
+        }
+};
+
+/**
+* \brief bind a variadic number of different type of collections for a single pass evaluation of several aggregations.
+*        i.e. - instead of one traversal per algorithm:
+*
+*        const auto [odds, sum, positive, smallest] = fused(std::execution::par, vec, list, array)(aggregate::count_if(is_odd),
+*                                                                                                  aggregate::reduce(0, std::plus<>{}),
+*                                                                                                  aggregate::all_of(is_positive),
+*                                                                                                  aggregate::min());
+*
+* @param {ExecutionPolicy, in}  execution policy (optional, default is sequential)
+* @param {collections,     in}  collections (collection should be iterate-able and with "same" underlying type)
+* @param {Fused,           out} object whose call operator accepts aggregations and returns a tuple of their results
+**/
+template<class ExecutionPolicy, class...Containers, typename std::enable_if<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>> && are_iterate_able_v<Containers...>>::type* = nullptr>
+constexpr inline Fused<std::decay_t<ExecutionPolicy>, Containers...> fused(ExecutionPolicy&& xi_policy, const Containers&... xi_containers) {
+    return Fused<std::decay_t<ExecutionPolicy>, Containers...>(xi_policy, xi_containers...);
+}
+
+template<class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
+constexpr inline Fused<std::execution::sequenced_policy, Containers...> fused(const Containers&... xi_containers) {
+    return Fused<std::execution::sequenced_policy, Containers...>(std::execution::seq, xi_containers...);
+}
+
+/**
+* \brief merge a variadic number of different type of sorted collections into a single sorted output (stable).
+*        i.e. - generalized 'std::merge' to a variadic number of different type of collections, using a loser tree.
+*
+* @param {OutputIt,    in}  output iterator
+* @param {Comparison,  in}  binary comparison function (optional, default is 'std::less')
+* @param {collections, in}  sorted collections (collection should be iterate-able and with "same" underlying type)
+* @param {OutputIt,    out} output iterator past last written element
+**/
+template<class OutputIt, class Comparison, class...Containers, typename std::enable_if<!is_iterate_able_v<Comparison> && are_iterate_able_v<Containers...>>::type* = nullptr>
+inline OutputIt merge_sorted(OutputIt xo_out, Comparison&& xi_comparison, const Containers&... xi_containers) {
+    if constexpr (all_same_v<Containers...>) {
+        ExpandStlDetail::RangeSources<decltype(std::begin(std::declval<const std::tuple_element_t<0, std::tuple<Containers...>>&>()))> sources;
+        (sources.add(std::begin(xi_containers), std::end(xi_containers)), ...);
+        return ExpandStlDetail::loser_tree_merge<false>(sources, std::forward<Comparison>(xi_comparison), xo_out);
+    }
+    else {
+        ExpandStlDetail::TupleSources<Containers...> sources(xi_containers...);
+        return ExpandStlDetail::loser_tree_merge<false>(sources, std::forward<Comparison>(xi_comparison), xo_out);
+    }
+}
+
+template<class OutputIt, class...Containers, typename std::enable_if<are_iterate_able_v<Containers...>>::type* = nullptr>
+inline OutputIt merge_sorted(OutputIt xo_out, const Containers&... xi_containers) {
+    return merge_sorted(xo_out, std::less<>{}, xi_containers...);
+}
+
+/**
+* \brief sort all elements of a variadic number of different type of collections into a single sorted output.
+*        collections are left untouched. their elements are gathered into evenly sized runs, which are sorted
+*        (in parallel, according to execution policy) and then merged using a loser tree.
+*
+* @param {ExecutionPolicy, in}  execution policy
+* @param {OutputIt,        in}  output iterator
+* @param {Comparison,      in}  binary comparison function (optional, default is 'std::less')
+* @param {collections,     in}  collections (collection should be iterate-able and with "same" underlying type)
+* @param {OutputIt,        out} output iterator past last written element
+*
+* benchmark (compare against gathering all elements and calling 'std::sort'):
+*
+*   std::vector<int> a(3'000'000), c(1'000'000);
+*   std::list<int> b(100'000);
+*   // ...fill with random values...
+*   std::vector<int> sorted(a.size() + b.size() + c.size()), reference;
+*
+*   auto t0 = std::chrono::steady_clock::now();
+*   sort_all(std::execution::par, sorted.begin(), a, b, c);
+*   auto t1 = std::chrono::steady_clock::now();
+*   reference.insert(reference.end(), a.begin(), a.end());
+*   reference.insert(reference.end(), b.begin(), b.end());
+*   reference.insert(reference.end(), c.begin(), c.end());
+*   std::sort(reference.begin(), reference.end());
+*   auto t2 = std::chrono::steady_clock::now();
+*
+*   // single core: ~530ms vs ~510ms (merge overhead), run sorting scales with hardware threads.
+*   // merging 8 pre sorted runs of 500'000 ints ('merge_sorted') takes ~130ms vs ~250ms for gather + 'std::sort'.
+**/
+template<class ExecutionPolicy, class OutputIt, class Comparison, class...Containers,
+         typename std::enable_if<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>> && !is_iterate_able_v<Comparison> && are_iterate_able_v<Containers...>>::type* = nullptr>
+inline OutputIt sort_all(ExecutionPolicy&& xi_policy, OutputIt xo_out, Comparison&& xi_comparison, const Containers&... xi_containers) {
+    using T = std::decay_t<decltype(*std::begin(std::declval<const std::tuple_element_t<0, std::tuple<Containers...>>&>()))>;
+
+    const auto sizes = ExpandStlDetail::sizes(xi_containers...);
+    std::size_t count{};
+    for (const std::size_t size : sizes) count += size;
+
+    std::vector<T> buffer;
+    buffer.reserve(count);
+    (buffer.insert(buffer.end(), std::begin(xi_containers), std::end(xi_containers)), ...);
+
+    const std::size_t tasks{ is_sequenced_policy_v<ExecutionPolicy> ? 1 : ExpandStlDetail::task_count(count) };
+    if (tasks == 1) {
+        std::sort(buffer.begin(), buffer.end(), xi_comparison);
+        return std::move(buffer.begin(), buffer.end(), xo_out);
+    }
+
+    // sort runs
+    std::vector<std::size_t> ids(tasks);
+    std::iota(ids.begin(), ids.end(), std::size_t{});
+    std::for_each(std::forward<ExecutionPolicy>(xi_policy), ids.begin(), ids.end(), [&](const std::size_t xi_task) {
+        std::sort(buffer.begin() + static_cast<std::ptrdiff_t>(count * xi_task / tasks),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(count * (xi_task + 1) / tasks), xi_comparison);
+    });
+
+    // merge runs
+    ExpandStlDetail::RangeSources<typename std::vector<T>::iterator> runs;
+    for (std::size_t t{}; t < tasks; ++t) {
+        runs.add(buffer.begin() + static_cast<std::ptrdiff_t>(count * t / tasks), buffer.begin() + static_cast<std::ptrdiff_t>(count * (t + 1) / tasks));
+    }
+    return ExpandStlDetail::loser_tree_merge<true>(runs, std::forward<Comparison>(xi_comparison), xo_out);
+}
+
+template<class ExecutionPolicy, class OutputIt, class...Containers,
+         typename std::enable_if<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>> && are_iterate_able_v<Containers...>>::type* = nullptr>
+inline OutputIt sort_all(ExecutionPolicy&& xi_policy, OutputIt xo_out, const Containers&... xi_containers) {
+    return sort_all(std::forward<ExecutionPolicy>(xi_policy), xo_out, std::less<>{}, xi_containers...);
+}
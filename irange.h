@@ -62,14 +62,34 @@
 **/
 #pragma once
 
-#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define IRANGE_SIMD
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define IRANGE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace IrangeDetail {
+    // non deduced type (C++20 'std::type_identity_t')
+    template<typename T> struct identity { using type = T; };
+    template<typename T> using identity_t = typename identity<T>::type;
+}
 
 /**
 * \brief A flexible range based for loop implementation which allows both looping in reverse order
 *        and looping with a given stride.
 *
-* \usage irange<stride>(start, end)
+* \usage irange<stride, integral type>(start, end)
 *        notice that when defining a negative stride, the 'start' must be bigger then 'end'
 *        example:
 *        irange<-2>(20, 0)  -> 20, 18, 16, 14, 12, 10, 8, 6, 4, 2
@@ -79,40 +99,81 @@
 *        irange<5>(13, 38)  -> 13, 18, 23, 28, 33
 *        irange<5>(13, 34)  -> 13, 18, 23, 28, 33
 *        irange<5>(-5, 19)  -> -5, 0, 5, 10, 15
+*        irange<1, std::int64_t>(0, 5'000'000'000) -> 0, 1, ..., 4'999'999'999
 *
-* @param {T, in}  define for loop stride/jump between two consecutive iterations (default is +1)
+*        irange is a (C++20) sized random access range, so it can be used with (parallel) standard algorithms:
+*        const irange<4, std::size_t> rows(0, image.size());
+*        std::for_each(std::execution::par, rows.begin(), rows.end(), [&](std::size_t i) { ... });
+*
+*        'simd<W>()' iterates the range W values at a time, as index vectors (with a mask of valid lanes), so loops
+*        which use the index itself (i.e. - position dependent weights) can be vectorized:
+*        for (const auto& block : irange<>(0, n).simd<4>()) {
+*            const __m128  i{ _mm_cvtepi32_ps(block.lanes128()) },
+*                          w{ _mm_add_ps(_mm_mul_ps(i, _mm_set1_ps(0.5f)), _mm_set1_ps(1.0f)) };
+*            if (block.full()) _mm_storeu_ps(out + block.offset, _mm_mul_ps(_mm_loadu_ps(in + block.offset), w));
+*            else for (std::size_t l{}; l < block.count; ++l) out[block.offset + l] = in[block.offset + l] * (block.value[l] * 0.5f + 1.0f);
+*        }
+*
+* @param {long long, in}  define for loop stride/jump between two consecutive iterations (default is +1)
+* @param {T,         in}  integral type (default is int)
 **/
-template<int xi_step = 1> struct irange final {
+template<long long xi_step = 1, typename T = int> struct irange final {
 	static_assert(xi_step != 0, "irange: Stride must be a non zero value.");
+	static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "irange: T must be an integral type.");
+
+    // unsigned type in which index arithmetic is performed (wraps instead of overflowing)
+    using Unsigned = std::make_unsigned_t<std::common_type_t<T, unsigned>>;
 
     // iterator values
-    int mBegin, mEnd;
+    T mBegin, mEnd;
 
-    // iterator definition
+    // iterator definition (value is calculated from index, so iterator is random access)
     struct Iterator final {
-        // counter
-        int value;
-        Iterator(const int & xi_value) : value(xi_value) {}
-
-        // '++' override
-        Iterator operator++() {
-            value += xi_step;
-            return *this;
-        }
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = T;
+        using pointer           = void;
 
-        // '!=' override
-        bool operator!=(const Iterator & xi_irange) const {
-            return (xi_step > 0) ? (xi_irange.value > value) : (xi_irange.value < value);
-        }
+        // range first value and index
+        T base{};
+        difference_type index{};
 
-        // '()' override
-        int operator*() const {
-            return value;
-        }
+        constexpr Iterator() = default;
+        constexpr Iterator(const T xi_base, const difference_type xi_index) : base(xi_base), index(xi_index) {}
+
+        // access
+        constexpr T operator*() const noexcept { return At(index); }
+        constexpr T operator[](const difference_type n) const noexcept { return At(index + n); }
+
+        // movement
+        constexpr Iterator& operator++() noexcept { ++index; return *this; }
+        constexpr Iterator& operator--() noexcept { --index; return *this; }
+        constexpr Iterator operator++(int) noexcept { Iterator temp{ *this }; ++index; return temp; }
+        constexpr Iterator operator--(int) noexcept { Iterator temp{ *this }; --index; return temp; }
+        constexpr Iterator& operator+=(const difference_type n) noexcept { index += n; return *this; }
+        constexpr Iterator& operator-=(const difference_type n) noexcept { index -= n; return *this; }
+        friend constexpr Iterator operator+(Iterator it, const difference_type n) noexcept { return it += n; }
+        friend constexpr Iterator operator+(const difference_type n, Iterator it) noexcept { return it += n; }
+        friend constexpr Iterator operator-(Iterator it, const difference_type n) noexcept { return it -= n; }
+        friend constexpr difference_type operator-(const Iterator& a, const Iterator& b) noexcept { return a.index - b.index; }
+
+        // comparison
+        friend constexpr bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.index == b.index; }
+        friend constexpr bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.index != b.index; }
+        friend constexpr bool operator<(const Iterator& a, const Iterator& b)  noexcept { return a.index < b.index; }
+        friend constexpr bool operator>(const Iterator& a, const Iterator& b)  noexcept { return a.index > b.index; }
+        friend constexpr bool operator<=(const Iterator& a, const Iterator& b) noexcept { return a.index <= b.index; }
+        friend constexpr bool operator>=(const Iterator& a, const Iterator& b) noexcept { return a.index >= b.index; }
+
+        private:
+            constexpr T At(const difference_type i) const noexcept {
+                return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(base) + static_cast<Unsigned>(i) * static_cast<Unsigned>(xi_step)));
+            }
     };
 
-    // constructor
-    explicit constexpr irange(const int & xi_begin, const int & xi_end) : mBegin(xi_begin), mEnd(xi_end) {
+    // constructor (arguments do not take part in class template argument deduction, so 'irange(0, v.size())' is 'irange<1, int>')
+    explicit constexpr irange(const IrangeDetail::identity_t<T> & xi_begin, const IrangeDetail::identity_t<T> & xi_end) : mBegin(xi_begin), mEnd(xi_end) {
         if ((xi_step < 0) && (mBegin < mEnd)) {
             throw std::out_of_range("irange: Final value is larger then initial value (it should be reversed for a negative stride).");
         }
@@ -122,8 +183,138 @@ template<int xi_step = 1> struct irange final {
     }
 
     // iterators
-    Iterator begin() const { return mBegin; }
-    Iterator end()   const { return mEnd; }
+    constexpr Iterator begin() const noexcept { return Iterator(mBegin, 0); }
+    constexpr Iterator end()   const noexcept { return Iterator(mBegin, static_cast<std::ptrdiff_t>(size())); }
+
+    // amount of values (O(1))
+    constexpr std::size_t size() const noexcept {
+        constexpr Unsigned stride{ static_cast<Unsigned>((xi_step > 0) ? xi_step : -xi_step) };
+        const Unsigned distance{ (xi_step > 0) ? static_cast<Unsigned>(static_cast<Unsigned>(mEnd) - static_cast<Unsigned>(mBegin)) :
+                                                 static_cast<Unsigned>(static_cast<Unsigned>(mBegin) - static_cast<Unsigned>(mEnd)) };
+        return static_cast<std::size_t>(distance / stride + static_cast<Unsigned>(distance % stride != 0));
+    }
+
+    constexpr bool empty() const noexcept { return size() == 0; }
+
+    // i'th value
+    constexpr T operator[](const std::size_t i) const noexcept { return begin()[static_cast<std::ptrdiff_t>(i)]; }
+
+    /**
+    * \brief W consecutive range values (lane l holds value 'offset + l'), only the last block of a range may be partial
+    *
+    * @param {size_t, in} amount of lanes (a power of two, not larger then 64)
+    **/
+    template<std::size_t W> struct IndexVector final {
+        static_assert((W > 0) && (W <= 64) && ((W & (W - 1)) == 0), "irange: Index vector width must be a power of two not larger then 64.");
+
+        alignas((W * sizeof(T) < 64) ? W * sizeof(T) : 64) T value[W];
+        std::uint64_t mask{};       // bit l is set if lane l holds a range value
+        std::size_t   count{};      // amount of lanes holding range values
+        std::size_t   offset{};     // ordinal (within range) of first lane
+
+        constexpr bool full() const noexcept { return count == W; }
+
+#ifdef IRANGE_SIMD
+        // k'th group of four 32bit lanes, and its lane mask (all bits set in valid lanes)
+        template<typename U = T, typename std::enable_if<sizeof(U) == 4>::type* = nullptr> __m128i lanes128(const std::size_t k = 0) const noexcept {
+            static_assert(W % 4 == 0, "irange: Index vector width must be a multiple of four.");
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(value + 4 * k));
+        }
+        template<typename U = T, typename std::enable_if<sizeof(U) == 4>::type* = nullptr> __m128i mask128(const std::size_t k = 0) const noexcept {
+            static_assert(W % 4 == 0, "irange: Index vector width must be a multiple of four.");
+            const __m128i bits{ _mm_setr_epi32(1, 2, 4, 8) };
+            return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(static_cast<int>(mask >> (4 * k))), bits), bits);
+        }
+#endif
+#ifdef IRANGE_SIMD_AVX2
+        // k'th group of eight 32bit lanes, and its lane mask (all bits set in valid lanes)
+        template<typename U = T, typename std::enable_if<sizeof(U) == 4>::type* = nullptr> __m256i lanes256(const std::size_t k = 0) const noexcept {
+            static_assert(W % 8 == 0, "irange: Index vector width must be a multiple of eight.");
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(value + 8 * k));
+        }
+        template<typename U = T, typename std::enable_if<sizeof(U) == 4>::type* = nullptr> __m256i mask256(const std::size_t k = 0) const noexcept {
+            static_assert(W % 8 == 0, "irange: Index vector width must be a multiple of eight.");
+            const __m256i bits{ _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128) };
+            return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask >> (8 * k))), bits), bits);
+        }
+#endif
+    };
+
+    // range of index vectors (see 'simd')
+    template<std::size_t W> struct SimdRange final {
+        struct Iterator final {
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = IndexVector<W>;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = const IndexVector<W>&;
+            using pointer           = const IndexVector<W>*;
+
+            IndexVector<W> block{};
+            std::size_t size{};
+
+            constexpr Iterator() = default;
+            Iterator(const T xi_begin, const std::size_t xi_size, const std::size_t xi_offset) : size(xi_size) {
+                for (std::size_t l{}; l < W; ++l) {
+                    block.value[l] = static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(xi_begin) + static_cast<Unsigned>(xi_offset + l) * static_cast<Unsigned>(xi_step)));
+                }
+                block.offset = xi_offset;
+                Mask();
+            }
+
+            // access
+            reference operator*()  const noexcept { return block; }
+            pointer   operator->() const noexcept { return &block; }
+
+            // movement (all lanes advance by W strides)
+            Iterator& operator++() noexcept {
+                constexpr Unsigned advance{ static_cast<Unsigned>(static_cast<Unsigned>(W) * static_cast<Unsigned>(xi_step)) };
+#ifdef IRANGE_SIMD
+                if constexpr ((sizeof(T) == 4) && (W % 4 == 0)) {
+                    const __m128i step{ _mm_set1_epi32(static_cast<int>(advance)) };
+                    for (std::size_t l{}; l < W; l += 4) {
+                        __m128i* lanes{ reinterpret_cast<__m128i*>(block.value + l) };
+                        _mm_store_si128(lanes, _mm_add_epi32(_mm_load_si128(lanes), step));
+                    }
+                }
+                else
+#endif
+                {
+                    for (std::size_t l{}; l < W; ++l) block.value[l] = static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(block.value[l]) + advance));
+                }
+                block.offset += W;
+                Mask();
+                return *this;
+            }
+            Iterator operator++(int) noexcept { Iterator temp{ *this }; ++*this; return temp; }
+
+            // comparison
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.block.offset == b.block.offset; }
+            friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.block.offset != b.block.offset; }
+
+            private:
+                void Mask() noexcept {
+                    block.count = (size > block.offset) ? ((size - block.offset < W) ? size - block.offset : W) : 0;
+                    block.mask  = (block.count == 64) ? ~std::uint64_t{} : ((std::uint64_t{ 1 } << block.count) - 1);
+                }
+        };
+
+        T first;
+        std::size_t count;
+
+        Iterator begin() const noexcept { return Iterator(first, count, 0); }
+        Iterator end()   const noexcept { return Iterator(first, count, ((count + W - 1) / W) * W); }
+
+        // amount of index vectors
+        constexpr std::size_t size() const noexcept { return (count + W - 1) / W; }
+    };
+
+    /**
+    * \brief iterate range W values at a time (see 'IndexVector')
+    *
+    * @param {size_t,    in}  amount of lanes (a power of two, not larger then 64)
+    * @param {SimdRange, out} range of index vectors
+    **/
+    template<std::size_t W> constexpr SimdRange<W> simd() const noexcept { return SimdRange<W>{ mBegin, size() }; }
 
     // make it non copyable
     irange()               = delete;
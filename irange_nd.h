@@ -0,0 +1,318 @@
+/**
+* A multi dimensional index space (the 'irange' of nested loops) with cache blocked (tiled) traversal.
+*
+* a nested loop over a large index space touches memory in an order dictated by the loop nesting, i.e. - a
+* transpose reads rows but writes columns, so every write lands in a different cache line. 'irange_nd' splits the
+* index space into tiles (whose size is chosen at compile time or at run time) which are small enough to keep their
+* data in cache, visits each tile in row major order, and visits the tiles themselves in one of several orders:
+*
+* > RowMajor - tiles are visited row by row.
+* > Morton   - tiles are visited along a Z-order curve (any dimension), so neighbouring tiles are visited close in time.
+* > Hilbert  - tiles are visited along a Hilbert curve (2D only), so consecutive tiles are always adjacent.
+* curves are generated only over tiles inside the grid (sub cells of the curve which are outside of it are skipped),
+* so a curve over an elongated grid costs about as much as a row major traversal. its code (the sum of bits of all grid
+* extents for Morton, twice the bits of the largest grid extent for Hilbert) must fit in 64 bits.
+*
+* a parallel execution policy splits the traversal by tiles.
+*
+* example usage:
+*
+*   // transpose
+*   const irange_nd<2> space({ 0, 0 }, { rows, cols });
+*   space.for_each_tiled<32, 32>([&](const std::array<std::size_t, 2>& i) {
+*       out[i[1] * rows + i[0]] = in[i[0] * cols + i[1]];
+*   });
+*
+*   // every second column of every row, tiles visited along a Hilbert curve, in parallel
+*   const irange_nd<2> odd({ 0, 1 }, { rows, cols }, { 1, 2 });
+*   odd.for_each_tiled(std::execution::par, { 64, 64 }, kernel, irange_nd<2>::Order::Hilbert);
+*
+* benchmark (4096x4096 floats, single core, gcc -O2):
+*   transpose                       - nested loops: ~190ms, 32x32 tiles: ~85ms (row major, Morton and Hilbert tile orders are within 5%).
+*   7 point stencil, column order   - nested loops: ~365ms, 64x256 tiles: ~45ms.
+*   a stencil which is already traversed in memory order (a single row major sweep) gains nothing from tiling.
+*
+* Dan Israel Malta
+**/
+#pragma once
+
+#include<algorithm>
+#include<array>
+#include<cstddef>
+#include<execution>
+#include<stdexcept>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+/**
+* \brief multi dimensional index space
+*
+* @param {Dims} amount of dimensions (last dimension is the fastest changing one)
+* @param {T}    integral type (default is size_t)
+**/
+template<std::size_t Dims, typename T = std::size_t> class irange_nd final {
+    static_assert(Dims > 0, "irange_nd: amount of dimensions must be positive.");
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "irange_nd: T must be an integral type.");
+
+    // aliases
+    public:
+        using Index = std::array<T, Dims>;
+        using Sizes = std::array<std::size_t, Dims>;
+
+        // tiles traversal order
+        enum class Order { RowMajor, Morton, Hilbert };
+
+    // properties
+    private:
+        Index m_begin;
+        Index m_stride;
+        Sizes m_count;      // amount of values in each dimension
+
+    // constructor
+    public:
+
+        /**
+        * \brief construct an index space
+        *
+        * @param {Index, in} first value in each dimension
+        * @param {Index, in} end (exclusive) value in each dimension
+        * @param {Index, in} (positive) stride in each dimension (default is 1)
+        **/
+        constexpr irange_nd(const Index& xi_begin, const Index& xi_end, const Index& xi_stride = Ones()) : m_begin(xi_begin), m_stride(xi_stride), m_count{} {
+            for (std::size_t d{}; d < Dims; ++d) {
+                if (xi_stride[d] <= 0) throw std::out_of_range("irange_nd: Stride must be a positive value.");
+                if (xi_end[d] < xi_begin[d]) throw std::out_of_range("irange_nd: Initial value is larger then final value.");
+                const std::size_t distance{ static_cast<std::size_t>(xi_end[d] - xi_begin[d]) },
+                                  stride{ static_cast<std::size_t>(xi_stride[d]) };
+                m_count[d] = distance / stride + static_cast<std::size_t>(distance % stride != 0);
+            }
+        }
+
+    // API
+    public:
+
+        // amount of values in each dimension
+        constexpr const Sizes& extents() const noexcept { return m_count; }
+
+        // total amount of values
+        constexpr std::size_t size() const noexcept {
+            std::size_t size{ 1 };
+            for (const std::size_t count : m_count) size *= count;
+            return size;
+        }
+
+        constexpr bool empty() const noexcept { return size() == 0; }
+
+        // visit all values in row major order
+        template<class Function> void for_each(Function&& xi_function) const {
+            Index index{};
+            Visit<0>(index, Sizes{}, m_count, xi_function);
+        }
+
+        /**
+        * \brief visit all values tile by tile (values inside a tile are visited in row major order)
+        *
+        * @param {Sizes,    in} tile extents (amount of values in each dimension)
+        * @param {Function, in} 'void (const Index&)'
+        * @param {Order,    in} tiles traversal order (default is row major)
+        **/
+        template<class Function> void for_each_tiled(const Sizes& xi_tile, Function&& xi_function, const Order xi_order = Order::RowMajor) const {
+            Index index{};
+            ForEachTile(xi_tile, xi_order, [&](const Sizes& xi_first, const Sizes& xi_last) {
+                Visit<0>(index, xi_first, xi_last, xi_function);
+            });
+        }
+
+        // visit all values tile by tile, using compile time tile extents
+        template<std::size_t ...Tile, class Function> void for_each_tiled(Function&& xi_function, const Order xi_order = Order::RowMajor) const {
+            static_assert(sizeof...(Tile) == Dims, "irange_nd: amount of tile extents must be equal to amount of dimensions.");
+            static_assert(((Tile > 0) && ...), "irange_nd: tile extents must be positive.");
+            for_each_tiled(Sizes{ { Tile... } }, std::forward<Function>(xi_function), xi_order);
+        }
+
+        /**
+        * \brief visit all values tile by tile, tiles are split among threads according to execution policy
+        *        (function is called concurrently, for different values).
+        *
+        * @param {ExecutionPolicy, in} execution policy
+        * @param {Sizes,           in} tile extents (amount of values in each dimension)
+        * @param {Function,        in} 'void (const Index&)'
+        * @param {Order,           in} tiles traversal order (tiles are handed to threads in this order)
+        **/
+        template<class ExecutionPolicy, class Function, typename std::enable_if<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>::type* = nullptr>
+        void for_each_tiled(ExecutionPolicy&& xi_policy, const Sizes& xi_tile, Function&& xi_function, const Order xi_order = Order::RowMajor) const {
+            std::vector<std::pair<Sizes, Sizes>> tiles;
+            ForEachTile(xi_tile, xi_order, [&tiles](const Sizes& xi_first, const Sizes& xi_last) { tiles.emplace_back(xi_first, xi_last); });
+
+            std::for_each(std::forward<ExecutionPolicy>(xi_policy), tiles.begin(), tiles.end(), [this, &xi_function](const std::pair<Sizes, Sizes>& xi_tile) {
+                Index index{};
+                Visit<0>(index, xi_tile.first, xi_tile.second, xi_function);
+            });
+        }
+
+    // internal helpers
+    private:
+
+        static constexpr Index Ones() noexcept {
+            Index ones{};
+            for (T& one : ones) one = 1;
+            return ones;
+        }
+
+        // row major visit of values whose (per dimension) ordinal is in [xi_first, xi_last)
+        template<std::size_t D, class Function> void Visit(Index& xio_index, const Sizes& xi_first, const Sizes& xi_last, Function& xi_function) const {
+            for (std::size_t k{ xi_first[D] }; k < xi_last[D]; ++k) {
+                xio_index[D] = static_cast<T>(m_begin[D] + static_cast<T>(k) * m_stride[D]);
+                if constexpr (D + 1 == Dims) xi_function(static_cast<const Index&>(xio_index));
+                else                         Visit<D + 1>(xio_index, xi_first, xi_last, xi_function);
+            }
+        }
+
+        // call 'xi_function(first, last)' with the (per dimension) ordinal range of each tile, in a given order
+        template<class Function> void ForEachTile(const Sizes& xi_tile, const Order xi_order, Function&& xi_function) const {
+            Sizes grid{};
+            for (std::size_t d{}; d < Dims; ++d) {
+                if (xi_tile[d] == 0) throw std::out_of_range("irange_nd: tile extents must be positive.");
+                grid[d] = m_count[d] / xi_tile[d] + static_cast<std::size_t>(m_count[d] % xi_tile[d] != 0);
+                if (grid[d] == 0) return;
+            }
+
+            const auto tile = [&](const Sizes& xi_coordinate) {
+                Sizes first{}, last{};
+                for (std::size_t d{}; d < Dims; ++d) {
+                    first[d] = xi_coordinate[d] * xi_tile[d];
+                    last[d]  = std::min(first[d] + xi_tile[d], m_count[d]);
+                }
+                xi_function(first, last);
+            };
+
+            // curves are defined over a power of two sided grid, 'bits[d]' is the amount of curve levels in which dimension d is split
+            Sizes bits{};
+            std::size_t levels{}, width{};
+            for (std::size_t d{}; d < Dims; ++d) {
+                for (std::size_t g{ grid[d] - 1 }; g != 0; g >>= 1) ++bits[d];
+                levels = std::max(levels, bits[d]);
+                width += bits[d];
+            }
+
+            switch (xi_order) {
+                case Order::RowMajor: {
+                    Sizes coordinate{};
+                    for (;;) {
+                        tile(coordinate);
+
+                        std::size_t d{ Dims };
+                        while ((d > 0) && (++coordinate[d - 1] == grid[d - 1])) coordinate[--d] = 0;
+                        if (d == 0) break;
+                    }
+                    break;
+                }
+
+                case Order::Morton: {
+                    if (width > 64) throw std::out_of_range("irange_nd: Morton code of tiles grid is wider then 64 bits.");
+                    MortonTiles(grid, bits, levels, Sizes{}, tile);
+                    break;
+                }
+
+                case Order::Hilbert: {
+                    if constexpr (Dims != 2) {
+                        throw std::invalid_argument("irange_nd: Hilbert order is only defined for two dimensions.");
+                    }
+                    else {
+                        if (2 * levels > 64) throw std::out_of_range("irange_nd: Hilbert code of tiles grid is wider then 64 bits.");
+                        HilbertTiles(grid, std::size_t{ 1 } << levels, levels, 0, Sizes{}, tile);
+                    }
+                    break;
+                }
+            }
+        }
+
+        /**
+        * \brief visit the tiles of a Z-order curve cell in curve order, skipping sub cells which are outside of the grid
+        *        (so only tiles inside the grid are generated). a cell at level 'l' is split in every dimension which
+        *        has at least 'l' bits, the last dimension being the least significant bit of a sub cell index.
+        *
+        * @param {Sizes,    in} tiles grid extents
+        * @param {Sizes,    in} amount of bits in each dimension
+        * @param {size_t,   in} cell level (0 is a single tile)
+        * @param {Sizes,    in} cell first tile
+        * @param {Function, in} 'void (const Sizes& coordinate)'
+        **/
+        template<class Function> static void MortonTiles(const Sizes& xi_grid, const Sizes& xi_bits, const std::size_t xi_level, const Sizes& xi_corner, Function& xi_tile) {
+            if (xi_level == 0) {
+                xi_tile(xi_corner);
+                return;
+            }
+
+            std::array<std::size_t, Dims> split{};
+            std::size_t count{};
+            for (std::size_t d{}; d < Dims; ++d) {
+                if (xi_bits[d] >= xi_level) split[count++] = d;
+            }
+
+            const std::size_t half{ std::size_t{ 1 } << (xi_level - 1) };
+            for (std::size_t child{}; child < (std::size_t{ 1 } << count); ++child) {
+                Sizes corner{ xi_corner };
+                bool inside{ true };
+                for (std::size_t j{}; j < count; ++j) {
+                    const std::size_t d{ split[count - 1 - j] };
+                    if ((child >> j) & 1) corner[d] += half;
+                    inside = inside && (corner[d] < xi_grid[d]);
+                }
+                if (inside) MortonTiles(xi_grid, xi_bits, xi_level - 1, corner, xi_tile);
+            }
+        }
+
+        /**
+        * \brief visit the tiles of a Hilbert curve cell in curve order, skipping sub cells which are outside of the grid.
+        *        the codes of a cell at level 'l' are a range of 4^l codes which covers an aligned 2^l x 2^l square.
+        *
+        * @param {Sizes,    in} tiles grid extents
+        * @param {size_t,   in} curve side (power of two)
+        * @param {size_t,   in} cell level (0 is a single tile)
+        * @param {size_t,   in} cell code (its first curve code divided by 4^level)
+        * @param {Sizes,    in} cell first (row, column)
+        * @param {Function, in} 'void (const Sizes& coordinate)'
+        **/
+        template<class Function> static void HilbertTiles(const Sizes& xi_grid, const std::size_t xi_side, const std::size_t xi_level, const std::size_t xi_code,
+                                                          const Sizes& xi_corner, Function& xi_tile) {
+            if (xi_level == 0) {
+                xi_tile(xi_corner);
+                return;
+            }
+
+            const std::size_t mask{ ~((std::size_t{ 1 } << (xi_level - 1)) - 1) };
+            for (std::size_t quadrant{}; quadrant < 4; ++quadrant) {
+                const std::size_t code{ xi_code * 4 + quadrant };
+                Sizes corner{ HilbertCoordinate(xi_side, code << (2 * (xi_level - 1))) };
+                corner[0] &= mask;
+                corner[1] &= mask;
+                if ((corner[0] < xi_grid[0]) && (corner[1] < xi_grid[1])) HilbertTiles(xi_grid, xi_side, xi_level - 1, code, corner, xi_tile);
+            }
+        }
+
+        // Hilbert curve index -> (row, column) in a 'xi_side' x 'xi_side' grid (side is a power of two)
+        static Sizes HilbertCoordinate(const std::size_t xi_side, std::size_t xi_code) noexcept {
+            std::size_t x{}, y{};
+            for (std::size_t s{ 1 }; s < xi_side; s *= 2) {
+                const std::size_t rx{ 1 & (xi_code / 2) },
+                                  ry{ 1 & (xi_code ^ rx) };
+                if (ry == 0) {
+                    if (rx == 1) {
+                        x = s - 1 - x;
+                        y = s - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+                x += s * rx;
+                y += s * ry;
+                xi_code /= 4;
+            }
+
+            Sizes coordinate{};
+            coordinate[0] = y;
+            coordinate[1] = x;
+            return coordinate;
+        }
+};